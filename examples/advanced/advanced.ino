@@ -1,5 +1,4 @@
 #include <Preferences.h>
-#include <WiFi.h>
 #include <WiFiProvisioner.h>
 
 const int buttonPin = 9; // GPIO pin number for the built-in BOOT button
@@ -18,38 +17,6 @@ WiFiProvisioner provisioner(
 
 Preferences preferences;
 
-// Function to connect to Wi-Fi using stored credentials
-bool connectToWiFi() {
-  preferences.begin("wifi-provision", true);
-  String savedSSID = preferences.getString("ssid", "");
-  String savedPassword = preferences.getString("password", "");
-  preferences.end();
-
-  if (savedSSID.isEmpty()) {
-    Serial.println("No saved Wi-Fi credentials found.");
-    return false;
-  }
-
-  Serial.printf("Connecting to saved Wi-Fi: %s\n", savedSSID.c_str());
-  if (savedPassword.isEmpty()) {
-    WiFi.begin(savedSSID.c_str());
-  } else {
-    WiFi.begin(savedSSID.c_str(), savedPassword.c_str());
-  }
-
-  unsigned long startTime = millis();
-  while (WiFi.status() != WL_CONNECTED) {
-    if (millis() - startTime > 10000) {
-      Serial.println("Failed to connect to saved Wi-Fi.");
-      return false;
-    }
-    delay(500);
-  }
-
-  Serial.printf("Successfully connected to %s\n", savedSSID.c_str());
-  return true;
-}
-
 void setup() {
   Serial.begin(9600);
 
@@ -76,27 +43,25 @@ void setup() {
       .onFactoryReset([]() {
         preferences.begin("wifi-provision", false);
         Serial.println("Factory reset triggered! Clearing preferences...");
-        preferences.clear(); // Clear all stored credentials and API key
+        preferences.clear(); // Clear the API key, the library clears Wi-Fi
         preferences.end();
       })
       .onSuccess([](const char *ssid, const char *password, const char *input) {
         Serial.printf("Provisioning successful! SSID: %s\n", ssid);
-        preferences.begin("wifi-provision", false);
-        // Store the credentials and API key in preferences
-        preferences.putString("ssid", String(ssid));
-        if (password) {
-          preferences.putString("password", String(password));
-        }
+        // The library stores the credentials, only the API key is left
         if (input) {
+          preferences.begin("wifi-provision", false);
           preferences.putString("apikey", String(input));
+          preferences.end();
+          Serial.println("API key saved.");
         }
-        preferences.end();
-        Serial.println("Credentials and API key saved.");
       });
 
-  if (!connectToWiFi()) {
-    // Start the provisioning process
-    provisioner.startProvisioning();
+  // Rejoin the stored network, or start provisioning if that fails
+  provisioner.connect();
+  WiFiProvisioner::ReconnectStats stats = provisioner.getReconnectStats();
+  if (stats.connected) {
+    Serial.printf("Reconnected in %lu ms\n", stats.timeToConnected);
   }
 }
 
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+"""Generates src/internal/provision_html_gz.h from src/internal/provision_html.h.
+
+The static `index_htmlN` fragments are compressed as one raw deflate stream
+that is flushed to a byte boundary after every fragment. At runtime the
+library places the `Config` strings at the flush points as stored deflate
+blocks and wraps the result in a gzip header and trailer, which yields a valid
+gzip member without compressing anything on the device.
+
+The flushes are full flushes (Z_FULL_FLUSH), which also drop the compression
+history. A back-reference from one fragment into an earlier one would have to
+skip over the `Config` strings in between, whose length is only known at
+runtime, so no match may cross a flush point. The page keeps its large static
+parts in one fragment for that reason.
+
+Run this script after every change to provision_html.h:
+
+    python3 extras/generate_gzip_html.py
+"""
+
+import os
+import re
+import zlib
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE = os.path.join(ROOT, "src", "internal", "provision_html.h")
+TARGET = os.path.join(ROOT, "src", "internal", "provision_html_gz.h")
+
+FRAGMENT = re.compile(
+    r'static constexpr const char (index_html\d+)\[\] PROGMEM =\s*'
+    r'R"rawliteral\((.*?)\)rawliteral";',
+    re.S,
+)
+
+
+def compress(fragments):
+    compressor = zlib.compressobj(9, zlib.DEFLATED, -15, 9)
+    return [
+        compressor.compress(raw) + compressor.flush(zlib.Z_FULL_FLUSH)
+        for raw in fragments
+    ]
+
+
+def fnv1a(data, value=0x811C9DC5):
+    for b in data:
+        value = ((value ^ b) * 0x01000193) & 0xFFFFFFFF
+    return value
+
+
+def to_array(data, indent="    ", per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        chunk = data[i : i + per_line]
+        lines.append(indent + ", ".join("0x%02x" % b for b in chunk) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    with open(SOURCE, "rb") as f:
+        source = f.read().decode("ascii")
+
+    fragments = FRAGMENT.findall(source)
+    if not fragments:
+        raise SystemExit("No fragments found in " + SOURCE)
+
+    out = [
+        "// Generated by extras/generate_gzip_html.py from provision_html.h.",
+        "// Do not edit by hand, run the script after changing the page.",
+        "#ifndef PROVISION_HTML_GZ_H",
+        "#define PROVISION_HTML_GZ_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+    ]
+
+    raws = [text.encode("ascii") for _, text in fragments]
+    page_hash = fnv1a(b"")
+    for raw in raws:
+        page_hash = fnv1a(raw, page_hash)
+
+    compressed = compress(raws)
+    for (name, _), gz in zip(fragments, compressed):
+        out.append("static constexpr const uint8_t %s_gz[] PROGMEM = {" % name)
+        out.append(to_array(gz))
+        out.append("};")
+        out.append("")
+
+    raw_total = sum(len(raw) for raw in raws)
+    gz_total = sum(len(gz) for gz in compressed)
+    out.append("// FNV-1a hash of all static fragments, used in the page ETag and")
+    out.append("// checked against provision_html.h when page_cache.cpp is compiled")
+    out.append("static constexpr uint32_t index_html_hash = 0x%08x;" % page_hash)
+    out.append("")
+    out.append("#endif // PROVISION_HTML_GZ_H")
+    out.append("")
+
+    with open(TARGET, "w", newline="\n") as f:
+        f.write("\n".join(out))
+
+    print(
+        "%d fragments: %d bytes -> %d bytes (%.1fx)"
+        % (len(fragments), raw_total, gz_total, raw_total / float(gz_total))
+    )
+
+
+if __name__ == "__main__":
+    main()
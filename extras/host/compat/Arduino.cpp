@@ -0,0 +1,48 @@
+#include "Arduino.h"
+#include <chrono>
+#include <stdarg.h>
+#include <thread>
+
+HostSerial Serial;
+
+namespace {
+
+const std::chrono::steady_clock::time_point startTime =
+    std::chrono::steady_clock::now();
+
+} // namespace
+
+unsigned long millis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now() - startTime)
+      .count();
+}
+
+unsigned long micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - startTime)
+      .count();
+}
+
+void delay(unsigned long ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void yield() { std::this_thread::yield(); }
+
+int HostSerial::printf(const char *format, ...) {
+  va_list args;
+  va_start(args, format);
+  int written = vfprintf(stderr, format, args);
+  va_end(args);
+  return written;
+}
+
+size_t HostSerial::print(const char *text) {
+  fputs(text, stderr);
+  return strlen(text);
+}
+
+size_t HostSerial::println(const char *text) {
+  return fprintf(stderr, "%s\n", text);
+}
@@ -0,0 +1,37 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Minimal subset of the Arduino core used by WiFiProvisioner, for host builds.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "IPAddress.h"
+
+#define PROGMEM
+#define strlen_P strlen
+#define memcpy_P memcpy
+#define pgm_read_byte(address) (*reinterpret_cast<const uint8_t *>(address))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+/**
+ * @brief Stand-in for `HardwareSerial` that prints to standard error.
+ */
+class HostSerial {
+public:
+  void begin(unsigned long baud) {}
+  int printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+  size_t print(const char *text);
+  size_t println(const char *text = "");
+};
+
+extern HostSerial Serial;
+
+#endif // HOST_ARDUINO_H
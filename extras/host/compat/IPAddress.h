@@ -0,0 +1,21 @@
+#ifndef HOST_IPADDRESS_H
+#define HOST_IPADDRESS_H
+
+#include <stdint.h>
+
+/**
+ * @brief Minimal IPv4 address matching the Arduino core's `IPAddress`.
+ */
+class IPAddress {
+public:
+  IPAddress() : _bytes{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _bytes{a, b, c, d} {}
+
+  uint8_t operator[](int index) const { return _bytes[index]; }
+  uint8_t &operator[](int index) { return _bytes[index]; }
+
+private:
+  uint8_t _bytes[4];
+};
+
+#endif // HOST_IPADDRESS_H
@@ -0,0 +1,51 @@
+/**
+ * Runs the provisioning portal on Linux against a scripted radio.
+ *
+ * Usage: host_portal [http-port] [dns-port] [credentials-file]
+ *
+ * Open http://localhost:8080/ and join "HomeNetwork" with the password
+ * "password123" or the open "CoffeeShop" network. The portal's statistics
+ * are served at http://localhost:8080/stats.
+ *
+ * With a credentials file, the network joined is stored in it and the next
+ * run reconnects to it without starting the portal.
+ */
+#include "linux_platform.h"
+#include <Arduino.h>
+#include <WiFiProvisioner.h>
+
+int main(int argc, char **argv) {
+  uint16_t httpPort = argc > 1 ? atoi(argv[1]) : 8080;
+  uint16_t dnsPort = argc > 2 ? atoi(argv[2]) : 5353;
+
+  LinuxPlatform platform(httpPort, dnsPort);
+  platform.radio().addNetwork("HomeNetwork", -48, "password123", 6);
+  platform.radio().addNetwork("CoffeeShop", -71, nullptr, 11);
+  platform.radio().addNetwork("Neighbour", -86, "secret", 1);
+  // A second mesh node and a hidden network, which the page does not list
+  platform.radio().addNetwork("HomeNetwork", -63, "password123", 1);
+  platform.radio().addNetwork("", -55, nullptr, 3);
+  platform.radio().setScanDuration(1500);
+  platform.radio().setConnectDelay(800);
+  if (argc > 3) {
+    platform.credentialStore()->setPath(argv[3]);
+  }
+
+  WiFiProvisioner provisioner(WiFiProvisioner::Config(), platform);
+  provisioner.setStatsEndpoint(true);
+  provisioner.onSuccess(
+      [](const char *ssid, const char *password, const char *input) {
+        Serial.printf("Provisioned SSID: %s\n", ssid);
+      });
+
+  if (provisioner.reconnect()) {
+    WiFiProvisioner::ReconnectStats stats = provisioner.getReconnectStats();
+    Serial.printf("Reconnected in %lu ms (%s)\n", stats.timeToConnected,
+                  stats.fastPath ? "fast path" : "full join");
+    return 0;
+  }
+
+  Serial.printf("Portal at http://localhost:%u/ (DNS on port %u)\n", httpPort,
+                dnsPort);
+  return provisioner.startProvisioning() ? 0 : 1;
+}
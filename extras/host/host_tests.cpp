@@ -0,0 +1,543 @@
+/**
+ * Unit tests of the library's platform-independent parts.
+ *
+ * Usage: make test
+ *
+ * Covers the credentials parser, the DNS responder, JSON string escaping,
+ * the reduction and versioning of scan results, and the gzip encoded page,
+ * which must decompress to the plain page. Exits with 1 if any check fails.
+ */
+#include "internal/credentials_parser.h"
+#include "internal/dns_responder.h"
+#include "internal/json_stream.h"
+#include "internal/page_cache.h"
+#include "internal/response_writer.h"
+#include "internal/scan_engine.h"
+#include <Arduino.h>
+#include <WiFiProvisioner.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+namespace {
+
+unsigned checks = 0;
+unsigned failures = 0;
+
+#define CHECK(condition)                                                       \
+  do {                                                                         \
+    checks++;                                                                  \
+    if (!(condition)) {                                                        \
+      failures++;                                                              \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition);     \
+    }                                                                          \
+  } while (0)
+
+/**
+ * @brief Radio whose scans report the networks set with `setNetworks()`
+ * as soon as they are started.
+ */
+class ScriptedRadio : public WiFiProvisionerPlatform::Radio {
+public:
+  void setNetworks(const std::vector<Network> &networks) {
+    _networks = networks;
+  }
+
+  bool startAccessPoint(const char *name, const IPAddress &ip,
+                        const IPAddress &netmask) override {
+    return true;
+  }
+  void stopAccessPoint() override {}
+  IPAddress accessPointIP() override { return IPAddress(); }
+
+  bool startScan() override { return true; }
+  int16_t scanComplete() override {
+    return static_cast<int16_t>(_networks.size());
+  }
+  bool scanResult(size_t index, Network &network) override {
+    if (index >= _networks.size()) {
+      return false;
+    }
+    network = _networks[index];
+    return true;
+  }
+  void scanDelete() override {}
+
+  void begin(const char *ssid, const char *password) override {}
+  void disconnect() override {}
+  bool isConnected() override { return false; }
+
+private:
+  std::vector<Network> _networks;
+};
+
+/**
+ * @brief Server that collects the response bytes instead of sending them.
+ */
+class CaptureServer : public WiFiProvisionerPlatform::HttpServer {
+public:
+  std::string output;
+
+  void on(const char *uri, Method method, Handler handler) override {}
+  void onNotFound(Handler handler) override {}
+  void collectHeaders(const char *names[], size_t count) override {}
+  bool begin() override { return true; }
+  void stop() override {}
+  void handleClient() override {}
+
+  bool hasArg(const char *name) override { return false; }
+  const char *arg(const char *name) override { return ""; }
+  const char *header(const char *name) override { return ""; }
+  const char *uri() override { return "/"; }
+  bool clientConnected() override { return true; }
+
+  size_t write(const uint8_t *data, size_t length) override {
+    output.append(reinterpret_cast<const char *>(data), length);
+    return length;
+  }
+  void endResponse() override {}
+};
+
+WiFiProvisionerPlatform::Radio::Network network(const char *ssid, int rssi,
+                                                bool open = false) {
+  WiFiProvisionerPlatform::Radio::Network network;
+  memset(&network, 0, sizeof(network));
+  strncpy(network.ssid, ssid, sizeof(network.ssid) - 1);
+  network.rssi = rssi;
+  network.open = open;
+  network.bssid[5] = static_cast<uint8_t>(-rssi);
+  network.channel = 1;
+  return network;
+}
+
+CredentialsParser::Result parse(CredentialsParser &parser, const char *body,
+                                size_t maxInputLength = 16) {
+  return parser.parse(body, strlen(body), maxInputLength);
+}
+
+std::string nested(const char *open, const char *close, size_t depth,
+                   const char *innermost = "") {
+  std::string body = "{\"x\":";
+  for (size_t i = 0; i < depth; ++i) {
+    body += open;
+  }
+  body += innermost;
+  for (size_t i = 0; i < depth; ++i) {
+    body += close;
+  }
+  return body + ",\"ssid\":\"Home\"}";
+}
+
+void testCredentialsParser() {
+  CredentialsParser parser;
+
+  CHECK(parse(parser, " {\"ssid\":\"Home\", \"password\":\"secret\","
+                      "\"code\":\"1234\"} trailing") == CredentialsParser::OK);
+  CHECK(strcmp(parser.ssid(), "Home") == 0);
+  CHECK(strcmp(parser.password(), "secret") == 0);
+  CHECK(strcmp(parser.input(), "1234") == 0);
+
+  // Non-string and nested credentials count as missing
+  CHECK(parse(parser, "{\"ssid\":\"Home\",\"password\":null,"
+                      "\"x\":{\"code\":\"1\"},\"y\":[1,-2.5e3,true]}") ==
+        CredentialsParser::OK);
+  CHECK(parser.password() == nullptr);
+  CHECK(parser.input() == nullptr);
+  CHECK(parse(parser, "{\"ssid\":\"Home\",\"ssid\":42}") ==
+        CredentialsParser::OK);
+  CHECK(parser.ssid() == nullptr);
+
+  // Escapes
+  CHECK(parse(parser, "{\"ssid\":\"a\\\"b\\\\c\\/d\\b\\f\\n\\r\\t\"}") ==
+        CredentialsParser::OK);
+  CHECK(strcmp(parser.ssid(), "a\"b\\c/d\b\f\n\r\t") == 0);
+  CHECK(parse(parser, "{\"ssid\":\"\\u0041\\u00e9\\u20AC\"}") ==
+        CredentialsParser::OK);
+  CHECK(strcmp(parser.ssid(), "A\xc3\xa9\xe2\x82\xac") == 0);
+  CHECK(parse(parser, "{\"ssid\":\"\\x\"}") == CredentialsParser::MALFORMED);
+  CHECK(parse(parser, "{\"ssid\":\"\\u00g0\"}") ==
+        CredentialsParser::MALFORMED);
+  CHECK(parse(parser, "{\"ssid\":\"\\u0000\"}") ==
+        CredentialsParser::MALFORMED);
+  CHECK(parse(parser, "{\"ssid\":\"a\tb\"}") == CredentialsParser::MALFORMED);
+
+  // Surrogates
+  CHECK(parse(parser, "{\"ssid\":\"\\ud83d\\ude00\"}") ==
+        CredentialsParser::OK);
+  CHECK(strcmp(parser.ssid(), "\xf0\x9f\x98\x80") == 0);
+  CHECK(parse(parser, "{\"ssid\":\"\\ud83d\"}") ==
+        CredentialsParser::MALFORMED);
+  CHECK(parse(parser, "{\"ssid\":\"\\ude00\"}") ==
+        CredentialsParser::MALFORMED);
+  CHECK(parse(parser, "{\"ssid\":\"\\ud83d\\u0041\"}") ==
+        CredentialsParser::MALFORMED);
+  CHECK(parse(parser, "{\"ssid\":\"\\ud83d\\ud83d\"}") ==
+        CredentialsParser::MALFORMED);
+
+  // Lengths are counted after decoding
+  std::string ssid(32, 's');
+  CHECK(parse(parser, ("{\"ssid\":\"" + ssid + "\"}").c_str()) ==
+        CredentialsParser::OK);
+  CHECK(strlen(parser.ssid()) == 32);
+  CHECK(parse(parser, ("{\"ssid\":\"" + ssid + "s\"}").c_str()) ==
+        CredentialsParser::TOO_LONG);
+  CHECK(parse(parser, ("{\"ssid\":\"" + ssid.substr(1) + "\\u00e9\"}")
+                          .c_str()) == CredentialsParser::TOO_LONG);
+  std::string password(64, 'p');
+  CHECK(parse(parser, ("{\"password\":\"" + password + "\"}").c_str()) ==
+        CredentialsParser::OK);
+  CHECK(parse(parser, ("{\"password\":\"" + password + "p\"}").c_str()) ==
+        CredentialsParser::TOO_LONG);
+  CHECK(parse(parser, "{\"code\":\"12345\"}", 5) == CredentialsParser::OK);
+  CHECK(parse(parser, "{\"code\":\"123456\"}", 5) ==
+        CredentialsParser::TOO_LONG);
+  // Other members may be any length
+  CHECK(parse(parser, ("{\"note\":\"" + std::string(500, 'n') + "\"}")
+                          .c_str()) == CredentialsParser::OK);
+
+  // Depth
+  size_t deepest = CredentialsParser::MAX_DEPTH - 1;
+  CHECK(parse(parser, nested("[", "]", deepest).c_str()) ==
+        CredentialsParser::OK);
+  CHECK(strcmp(parser.ssid(), "Home") == 0);
+  CHECK(parse(parser, nested("[", "]", deepest + 1).c_str()) ==
+        CredentialsParser::MALFORMED);
+  CHECK(parse(parser, nested("{\"a\":", "}", deepest, "0").c_str()) ==
+        CredentialsParser::OK);
+  CHECK(parse(parser, nested("{\"a\":", "}", deepest + 1, "0").c_str()) ==
+        CredentialsParser::MALFORMED);
+
+  // Malformed bodies
+  const char *malformed[] = {
+      "",          "[]",           "\"ssid\"",        "{",
+      "{\"ssid\"", "{\"ssid\":",   "{\"ssid\":\"ab",  "{\"ssid\":\"a\",}",
+      "{ssid:1}",  "{\"a\":tru}",  "{\"a\":-}",       "{\"a\":[1,]}",
+      "{\"a\":1 \"b\":2}",
+  };
+  for (const char *body : malformed) {
+    CHECK(parse(parser, body) == CredentialsParser::MALFORMED);
+  }
+  // The body need not be null-terminated
+  CHECK(parser.parse("{\"ssid\":\"Home\"}garbage", 15, 16) ==
+        CredentialsParser::OK);
+  CHECK(parser.parse("{\"ssid\":\"Home\"}", 14, 16) ==
+        CredentialsParser::MALFORMED);
+}
+
+std::vector<uint8_t> query(const char *name, uint16_t type) {
+  std::vector<uint8_t> packet = {0x12, 0x34, 0x01, 0x00, 0x00, 0x01,
+                                 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+  while (*name) {
+    const char *dot = strchr(name, '.');
+    size_t length = dot ? static_cast<size_t>(dot - name) : strlen(name);
+    packet.push_back(static_cast<uint8_t>(length));
+    packet.insert(packet.end(), name, name + length);
+    name += length + (dot ? 1 : 0);
+  }
+  packet.push_back(0);
+  packet.push_back(type >> 8);
+  packet.push_back(type & 0xff);
+  packet.push_back(0x00);
+  packet.push_back(0x01);
+  return packet;
+}
+
+size_t answer(std::vector<uint8_t> packet, size_t length, size_t capacity,
+              std::vector<uint8_t> *result = nullptr) {
+  packet.resize(capacity);
+  size_t answered =
+      DnsResponder::answer(packet.data(), length, capacity,
+                           IPAddress(192, 168, 4, 1));
+  if (result) {
+    *result = packet;
+  }
+  return answered;
+}
+
+void testDnsResponder() {
+  const size_t capacity = DnsResponder::MAX_PACKET_SIZE;
+  std::vector<uint8_t> a = query("connectivitycheck.gstatic.com", 1);
+  std::vector<uint8_t> response;
+
+  CHECK(answer(a, a.size(), capacity, &response) == a.size() + 16);
+  CHECK(response[0] == 0x12 && response[1] == 0x34);
+  CHECK(response[2] == 0x85 && response[3] == 0x80);
+  CHECK(response[5] == 1 && response[7] == 1);
+  CHECK(memcmp(response.data() + 12, a.data() + 12, a.size() - 12) == 0);
+  const uint8_t address[] = {192, 168, 4, 1};
+  CHECK(memcmp(response.data() + a.size() + 12, address, 4) == 0);
+
+  // Other types get an empty answer
+  std::vector<uint8_t> aaaa = query("example.com", 28);
+  CHECK(answer(aaaa, aaaa.size(), capacity, &response) == aaaa.size());
+  CHECK(response[7] == 0);
+  std::vector<uint8_t> any = query("example.com", 255);
+  CHECK(answer(any, any.size(), capacity) == any.size() + 16);
+
+  // Truncated and malformed queries are dropped
+  for (size_t length = 0; length < a.size(); ++length) {
+    CHECK(answer(a, length, capacity) == 0);
+  }
+  CHECK(answer(a, a.size(), a.size() + 15) == 0);
+  CHECK(answer(a, a.size(), a.size() + 16) == a.size() + 16);
+
+  std::vector<uint8_t> packet = a;
+  packet[2] |= 0x80; // A response
+  CHECK(answer(packet, packet.size(), capacity) == 0);
+  packet = a;
+  packet[5] = 2; // Two questions
+  CHECK(answer(packet, packet.size(), capacity) == 0);
+  packet[4] = 1;
+  packet[5] = 1;
+  CHECK(answer(packet, packet.size(), capacity) == 0);
+  packet = a;
+  packet[12] = 0xc0; // Compressed name pointing past the end
+  CHECK(answer(packet, packet.size(), capacity) == 0);
+  packet = a;
+  packet[12] = 0xff; // Label longer than the packet
+  CHECK(answer(packet, packet.size(), capacity) == 0);
+  packet = a;
+  packet.back() = 0xff;
+  packet.resize(packet.size() + 64, 0xff); // Name without a terminator
+  std::fill(packet.begin() + 12, packet.end(), 0x01);
+  CHECK(answer(packet, packet.size(), capacity) == 0);
+}
+
+std::string json(const char *text) {
+  CaptureServer server;
+  WiFiProvisioner::ResponseStats stats = WiFiProvisioner::ResponseStats();
+  {
+    ResponseWriter response(server, stats);
+    JsonStream stream(response);
+    stream.beginObject().key("v").value(text).endObject();
+    response.end();
+  }
+  return server.output;
+}
+
+void testJsonStream() {
+  CHECK(json("plain") == "{\"v\":\"plain\"}");
+  CHECK(json("") == "{\"v\":\"\"}");
+  CHECK(json(nullptr) == "{\"v\":null}");
+  CHECK(json("a\"b\\c/d") == "{\"v\":\"a\\\"b\\\\c/d\"}");
+  CHECK(json("\b\f\n\r\t") == "{\"v\":\"\\b\\f\\n\\r\\t\"}");
+  CHECK(json("\x01x\x1f") == "{\"v\":\"\\u0001x\\u001f\"}");
+  CHECK(json("\x7f\xc3\xa9") == "{\"v\":\"\x7f\xc3\xa9\"}");
+  CHECK(json("\"\"") == "{\"v\":\"\\\"\\\"\"}");
+
+  // Strings longer than the response buffer
+  std::string text;
+  std::string expected = "{\"v\":\"";
+  for (size_t i = 0; i < 3000; ++i) {
+    text += i % 100 == 0 ? '"' : 'x';
+    expected += i % 100 == 0 ? "\\\"" : "x";
+  }
+  CHECK(json(text.c_str()) == expected + "\"}");
+
+  CaptureServer server;
+  WiFiProvisioner::ResponseStats stats = WiFiProvisioner::ResponseStats();
+  {
+    ResponseWriter response(server, stats);
+    JsonStream stream(response);
+    stream.beginObject()
+        .key("a\nb")
+        .beginArray()
+        .value(-9223372036854775807LL - 1)
+        .value(18446744073709551615ULL)
+        .value(true)
+        .beginObject()
+        .endObject()
+        .endArray()
+        .key("c")
+        .value(0)
+        .endObject();
+    response.end();
+  }
+  CHECK(server.output == "{\"a\\nb\":[-9223372036854775808,"
+                         "18446744073709551615,true,{}],\"c\":0}");
+}
+
+void scan(ScanEngine &engine, ScriptedRadio &radio,
+          const std::vector<WiFiProvisionerPlatform::Radio::Network> &found) {
+  radio.setNetworks(found);
+  CHECK(engine.start());
+  engine.poll();
+  CHECK(!engine.isScanning());
+}
+
+size_t indexOf(const ScanEngine &engine, const char *ssid) {
+  for (size_t i = 0; i < engine.count(); ++i) {
+    if (strcmp(engine.at(i).ssid, ssid) == 0) {
+      return i;
+    }
+  }
+  return engine.count();
+}
+
+void testScanEngine() {
+  ScriptedRadio radio;
+  ScanEngine engine(radio);
+  CHECK(!engine.start());
+  CHECK(engine.allocate());
+
+  // Each SSID is kept once with its strongest access point, hidden networks
+  // are dropped, and the rest is sorted by signal strength
+  scan(engine, radio,
+       {network("Home", -80), network("", -30), network("Cafe", -70, true),
+        network("Home", -45), network("Home", -60)});
+  CHECK(engine.hasResults());
+  CHECK(engine.count() == 2);
+  CHECK(strcmp(engine.at(0).ssid, "Home") == 0);
+  CHECK(engine.at(0).rssi == -45);
+  CHECK(engine.at(0).bssid[5] == 45);
+  CHECK(strcmp(engine.at(1).ssid, "Cafe") == 0);
+  CHECK(engine.at(1).open);
+
+  // Only the strongest `limit` are kept
+  engine.setLimit(3);
+  scan(engine, radio,
+       {network("A", -90), network("B", -50), network("C", -70),
+        network("D", -40), network("E", -85), network("C", -45),
+        network("F", -60)});
+  CHECK(engine.count() == 3);
+  CHECK(strcmp(engine.at(0).ssid, "D") == 0);
+  CHECK(strcmp(engine.at(1).ssid, "C") == 0);
+  CHECK(engine.at(1).rssi == -45);
+  CHECK(strcmp(engine.at(2).ssid, "B") == 0);
+  engine.setLimit(WIFI_PROVISIONER_MAX_NETWORKS);
+
+  // Versions
+  engine.reset();
+  uint32_t base = engine.version();
+  CHECK(engine.knowsChangesSince(base));
+  scan(engine, radio, {network("A", -50), network("B", -70)});
+  uint32_t first = engine.version();
+  CHECK(first == base + 1);
+  CHECK(engine.changedIn(indexOf(engine, "A")) == first);
+  CHECK(engine.changedIn(indexOf(engine, "B")) == first);
+
+  // Jitter within a signal level is not a change
+  scan(engine, radio, {network("A", -52), network("B", -71)});
+  CHECK(engine.version() == first);
+
+  // A level change, a new network and a removal
+  scan(engine, radio, {network("A", -85), network("C", -60)});
+  uint32_t second = engine.version();
+  CHECK(second == first + 1);
+  CHECK(engine.changedIn(indexOf(engine, "A")) == second);
+  CHECK(engine.changedIn(indexOf(engine, "C")) == second);
+  CHECK(engine.removedCount() == 1);
+  uint32_t removedIn = 0;
+  CHECK(strcmp(engine.removed(0, removedIn), "B") == 0);
+  CHECK(removedIn == second);
+  CHECK(engine.knowsChangesSince(first));
+  CHECK(!engine.knowsChangesSince(second + 1));
+
+  // A security change, then a network that is back, which is listed as
+  // changed rather than removed
+  scan(engine, radio, {network("A", -85), network("C", -60, true)});
+  CHECK(engine.version() == second + 1);
+  CHECK(engine.changedIn(indexOf(engine, "A")) == second);
+  CHECK(engine.changedIn(indexOf(engine, "C")) == second + 1);
+
+  scan(engine, radio,
+       {network("A", -85), network("B", -70), network("C", -60, true)});
+  CHECK(engine.version() == second + 2);
+  CHECK(engine.removedCount() == 0);
+  CHECK(engine.changedIn(indexOf(engine, "B")) == second + 2);
+
+  // Once the removals overflow, the oldest changes are no longer known
+  uint32_t before = engine.version();
+  for (size_t i = 0; i <= WIFI_PROVISIONER_MAX_NETWORKS; ++i) {
+    char ssid[8];
+    snprintf(ssid, sizeof(ssid), "N%u", static_cast<unsigned>(i));
+    scan(engine, radio, {network(ssid, -50)});
+  }
+  CHECK(engine.removedCount() == WIFI_PROVISIONER_MAX_NETWORKS);
+  CHECK(!engine.knowsChangesSince(before));
+  CHECK(engine.knowsChangesSince(engine.version() - 1));
+
+  engine.release();
+  CHECK(!engine.hasResults());
+  CHECK(!engine.start());
+}
+
+std::string inflate(const char *data, size_t length) {
+  z_stream stream;
+  memset(&stream, 0, sizeof(stream));
+  if (inflateInit2(&stream, 16 + MAX_WBITS) != Z_OK) {
+    return "";
+  }
+  stream.next_in =
+      reinterpret_cast<Bytef *>(const_cast<char *>(data));
+  stream.avail_in = static_cast<uInt>(length);
+
+  std::string output;
+  char buffer[4096];
+  int result;
+  do {
+    stream.next_out = reinterpret_cast<Bytef *>(buffer);
+    stream.avail_out = sizeof(buffer);
+    result = inflate(&stream, Z_NO_FLUSH);
+    output.append(buffer, sizeof(buffer) - stream.avail_out);
+  } while (result == Z_OK);
+  bool complete = result == Z_STREAM_END && stream.avail_in == 0;
+  inflateEnd(&stream);
+  return complete ? output : "";
+}
+
+void checkGzipPage(PageCache &cache, const WiFiProvisioner::Config &config) {
+  size_t length = 0;
+  bool gzip = false;
+  const char *page = cache.acquire(config, length, gzip);
+  CHECK(page != nullptr && !gzip);
+  std::string plain(page, length);
+
+  gzip = true;
+  page = cache.acquire(config, length, gzip);
+  CHECK(page != nullptr && gzip);
+  CHECK(length > 0 && length < plain.size() / 3);
+  CHECK(inflate(page, length) == plain);
+
+  char inputLength[12];
+  PageCache::Fragment parts[PageCache::FRAGMENT_COUNT];
+  std::string streamed;
+  size_t total = PageCache::fragments(config, inputLength, parts);
+  for (const PageCache::Fragment &part : parts) {
+    streamed.append(part.data, part.length);
+  }
+  CHECK(total == streamed.size());
+  CHECK(streamed == plain);
+}
+
+void testPageCache() {
+  PageCache cache;
+  WiFiProvisioner::Config config;
+  checkGzipPage(cache, config);
+
+  config.PROJECT_TITLE = "Kitchen \"Sensor\" <b>&amp;</b> \xc3\xa9";
+  config.THEME_COLOR = "#ff8800";
+  config.SHOW_INPUT_FIELD = true;
+  config.INPUT_LENGTH = 12;
+  checkGzipPage(cache, config);
+
+  config.PROJECT_INFO = "";
+  config.SVG_LOGO = "";
+  config.SHOW_RESET_FIELD = false;
+  checkGzipPage(cache, config);
+}
+
+} // namespace
+
+int main() {
+  testCredentialsParser();
+  testDnsResponder();
+  testJsonStream();
+  testScanEngine();
+  testPageCache();
+
+  printf("%u checks, %u failed\n", checks, failures);
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,414 @@
+#include "linux_platform.h"
+#include "internal/dns_responder.h"
+#include "internal/socket_http_server.h"
+#include <Arduino.h>
+#include <arpa/inet.h>
+#include <atomic>
+#include <errno.h>
+#include <malloc.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *pointer, size_t size);
+void __libc_free(void *pointer);
+}
+
+namespace {
+
+std::atomic<int64_t> heapInUse(0);
+std::atomic<int64_t> heapPeak(0);
+thread_local bool heapUntracked = false;
+
+void trackHeap(void *pointer, bool allocated) {
+  if (pointer == nullptr || heapUntracked) {
+    return;
+  }
+  int64_t size = malloc_usable_size(pointer);
+  if (!allocated) {
+    heapInUse -= size;
+    return;
+  }
+  int64_t inUse = heapInUse += size;
+  int64_t peak = heapPeak.load();
+  while (inUse > peak && !heapPeak.compare_exchange_weak(peak, inUse)) {
+  }
+}
+
+/**
+ * @brief Opens a non-blocking socket bound to the given port on all
+ * interfaces.
+ *
+ * @return The socket, or `-1` on failure.
+ */
+int bindSocket(int type, uint16_t port) {
+  int fd = socket(AF_INET, type | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    return -1;
+  }
+
+  int reuse = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons(port);
+  if (bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+} // namespace
+
+extern "C" {
+
+void *malloc(size_t size) {
+  void *pointer = __libc_malloc(size);
+  trackHeap(pointer, true);
+  return pointer;
+}
+
+void *calloc(size_t count, size_t size) {
+  void *pointer = __libc_calloc(count, size);
+  trackHeap(pointer, true);
+  return pointer;
+}
+
+void *realloc(void *pointer, size_t size) {
+  trackHeap(pointer, false);
+  void *result = __libc_realloc(pointer, size);
+  trackHeap(result ? result : pointer, true);
+  return result;
+}
+
+void free(void *pointer) {
+  trackHeap(pointer, false);
+  __libc_free(pointer);
+}
+}
+
+LinuxRadio::LinuxRadio()
+    : _apIP(), _joined(NONE), _scanDuration(0), _connectDelay(0),
+      _joinDelay(0), _scanStartedAt(0), _connectStartedAt(0), _scanning(false),
+      _scanDone(false) {}
+
+/**
+ * @brief Adds a network that scans report and `begin()` can join.
+ *
+ * @param ssid The SSID of the network.
+ * @param rssi The signal strength in dBm.
+ * @param password The password of the network, or `nullptr` for an open
+ * network.
+ * @param channel The primary channel of the network.
+ */
+void LinuxRadio::addNetwork(const char *ssid, int32_t rssi,
+                            const char *password, int32_t channel) {
+  Entry entry = {};
+  strncpy(entry.network.ssid, ssid, sizeof(entry.network.ssid) - 1);
+  entry.network.rssi = rssi;
+  entry.network.open = password == nullptr;
+  entry.network.channel = channel;
+  uint8_t bssid[6] = {0x02, 0x00, 0x00, 0x00, 0x00,
+                      static_cast<uint8_t>(_networks.size())};
+  memcpy(entry.network.bssid, bssid, sizeof(bssid));
+  entry.password = password ? password : "";
+  _networks.push_back(entry);
+}
+
+/**
+ * @brief Sets how long a scan runs before its results are reported.
+ */
+void LinuxRadio::setScanDuration(unsigned long scanDuration) {
+  _scanDuration = scanDuration;
+}
+
+/**
+ * @brief Sets how long joining a network takes.
+ */
+void LinuxRadio::setConnectDelay(unsigned long connectDelay) {
+  _connectDelay = connectDelay;
+}
+
+bool LinuxRadio::startAccessPoint(const char *name, const IPAddress &ip,
+                                  const IPAddress &netmask) {
+  _apIP = ip;
+  return true;
+}
+
+void LinuxRadio::stopAccessPoint() { _apIP = IPAddress(); }
+
+IPAddress LinuxRadio::accessPointIP() { return _apIP; }
+
+bool LinuxRadio::startScan() {
+  _scanning = true;
+  _scanDone = false;
+  _scanStartedAt = millis();
+  return true;
+}
+
+int16_t LinuxRadio::scanComplete() {
+  if (_scanning && millis() - _scanStartedAt >= _scanDuration) {
+    _scanning = false;
+    _scanDone = true;
+  }
+  if (_scanning) {
+    return SCAN_RUNNING;
+  }
+  return _scanDone ? static_cast<int16_t>(_networks.size()) : SCAN_FAILED;
+}
+
+bool LinuxRadio::scanResult(size_t index, Network &network) {
+  if (!_scanDone || index >= _networks.size()) {
+    return false;
+  }
+  network = _networks[index].network;
+  return true;
+}
+
+void LinuxRadio::scanDelete() {
+  _scanning = false;
+  _scanDone = false;
+}
+
+void LinuxRadio::begin(const char *ssid, const char *password) {
+  _joined = find(ssid, password);
+  _joinDelay = _connectDelay;
+  _connectStartedAt = millis();
+}
+
+void LinuxRadio::disconnect() { _joined = NONE; }
+
+bool LinuxRadio::isConnected() {
+  return _joined != NONE && millis() - _connectStartedAt >= _joinDelay;
+}
+
+/**
+ * @brief Reports the joined network with a lease of 192.168.1.100 plus its
+ * index.
+ */
+bool LinuxRadio::link(Link &link) {
+  if (!isConnected()) {
+    return false;
+  }
+  const Network &network = _networks[_joined].network;
+  memcpy(link.bssid, network.bssid, sizeof(link.bssid));
+  link.channel = network.channel;
+  const uint8_t ip[4] = {192, 168, 1, static_cast<uint8_t>(100 + _joined)};
+  const uint8_t gateway[4] = {192, 168, 1, 1};
+  const uint8_t subnet[4] = {255, 255, 255, 0};
+  memcpy(link.ip, ip, sizeof(ip));
+  memcpy(link.gateway, gateway, sizeof(gateway));
+  memcpy(link.subnet, subnet, sizeof(subnet));
+  memcpy(link.dns, gateway, sizeof(gateway));
+  return true;
+}
+
+/**
+ * @brief Joins in a quarter of the connect delay if the network is still on
+ * the access point and channel of `link`, and fails otherwise, like a station
+ * that finds nothing where it expected the access point.
+ */
+void LinuxRadio::rejoin(const char *ssid, const char *password,
+                        const Link &link) {
+  _joined = find(ssid, password);
+  if (_joined != NONE) {
+    const Network &network = _networks[_joined].network;
+    if (memcmp(network.bssid, link.bssid, sizeof(link.bssid)) != 0 ||
+        network.channel != link.channel) {
+      _joined = NONE;
+    }
+  }
+  _joinDelay = _connectDelay / 4;
+  _connectStartedAt = millis();
+}
+
+/**
+ * @brief Returns the index of the network matching the credentials, or
+ * `NONE`.
+ */
+size_t LinuxRadio::find(const char *ssid, const char *password) const {
+  for (size_t i = 0; i < _networks.size(); ++i) {
+    if (strcmp(_networks[i].network.ssid, ssid) == 0 &&
+        _networks[i].password == (password ? password : "")) {
+      return i;
+    }
+  }
+  return NONE;
+}
+
+LinuxCredentialStore::LinuxCredentialStore()
+    : _path(), _credentials(), _stored(false) {}
+
+/**
+ * @brief Keeps the credentials in a file as well, loading what it holds.
+ */
+void LinuxCredentialStore::setPath(const char *path) {
+  _path = path;
+  _stored = false;
+  FILE *file = fopen(path, "rb");
+  if (file == nullptr) {
+    return;
+  }
+  _stored = fread(&_credentials, sizeof(_credentials), 1, file) == 1;
+  fclose(file);
+}
+
+bool LinuxCredentialStore::load(Credentials &credentials) {
+  if (!_stored) {
+    return false;
+  }
+  credentials = _credentials;
+  return true;
+}
+
+bool LinuxCredentialStore::save(const Credentials &credentials) {
+  _credentials = credentials;
+  _stored = true;
+  if (_path.empty()) {
+    return true;
+  }
+  FILE *file = fopen(_path.c_str(), "wb");
+  if (file == nullptr) {
+    return false;
+  }
+  bool written = fwrite(&_credentials, sizeof(_credentials), 1, file) == 1;
+  return fclose(file) == 0 && written;
+}
+
+void LinuxCredentialStore::clear() {
+  _stored = false;
+  if (!_path.empty()) {
+    remove(_path.c_str());
+  }
+}
+
+UdpDnsServer::UdpDnsServer(uint16_t portOverride)
+    : _portOverride(portOverride), _socket(-1), _ip() {}
+
+UdpDnsServer::~UdpDnsServer() { stop(); }
+
+bool UdpDnsServer::start(uint16_t port, const IPAddress &ip) {
+  uint16_t listenPort = _portOverride ? _portOverride : port;
+  _ip = ip;
+  _socket = bindSocket(SOCK_DGRAM, listenPort);
+  if (_socket < 0) {
+    Serial.printf("[host] Failed to bind DNS port %u: %s\n", listenPort,
+                  strerror(errno));
+    return false;
+  }
+  return true;
+}
+
+void UdpDnsServer::stop() {
+  if (_socket >= 0) {
+    close(_socket);
+    _socket = -1;
+  }
+}
+
+/**
+ * @brief Answers one pending query, if any.
+ *
+ * @return `true` if a datagram was received.
+ */
+bool UdpDnsServer::processNextRequest() {
+  if (_socket < 0) {
+    return false;
+  }
+
+  uint8_t packet[DnsResponder::MAX_PACKET_SIZE];
+  sockaddr_in from = {};
+  socklen_t fromLength = sizeof(from);
+  ssize_t length = recvfrom(_socket, packet, sizeof(packet), 0,
+                            reinterpret_cast<sockaddr *>(&from), &fromLength);
+  if (length < 0) {
+    return false;
+  }
+
+  size_t responseLength =
+      DnsResponder::answer(packet, length, sizeof(packet), _ip);
+  if (responseLength > 0) {
+    sendto(_socket, packet, responseLength, 0,
+           reinterpret_cast<sockaddr *>(&from), fromLength);
+  }
+  return true;
+}
+
+LinuxPlatform::LinuxPlatform(uint16_t httpPort, uint16_t dnsPort)
+    : _radio(), _credentialStore(), _httpPort(httpPort), _dnsPort(dnsPort),
+      _heapSize(DEFAULT_HEAP_SIZE), _heapBase(::heapInUse) {}
+
+/**
+ * @brief Sets the size of the heap `memory()` models.
+ */
+void LinuxPlatform::setHeapSize(size_t heapSize) { _heapSize = heapSize; }
+
+LinuxRadio &LinuxPlatform::radio() { return _radio; }
+
+WiFiProvisionerPlatform::HttpServer *
+LinuxPlatform::createHttpServer(uint16_t port) {
+  return new SocketHttpServer(_httpPort ? _httpPort : port);
+}
+
+WiFiProvisionerPlatform::DnsServer *LinuxPlatform::createDnsServer() {
+  return new UdpDnsServer(_dnsPort);
+}
+
+LinuxCredentialStore *LinuxPlatform::credentialStore() {
+  return &_credentialStore;
+}
+
+/**
+ * @brief Reports the modelled heap. As the host heap does not fragment like
+ * an ESP32's, the largest free block is all of the free heap.
+ */
+WiFiProvisionerPlatform::Memory LinuxPlatform::memory() {
+  int64_t used = ::heapInUse - _heapBase;
+  if (used < 0) {
+    used = 0;
+  }
+  Memory memory;
+  memory.freeHeap =
+      static_cast<uint64_t>(used) < _heapSize ? _heapSize - used : 0;
+  memory.largestFreeBlock = memory.freeHeap;
+  memory.stackHighWaterMark = 0;
+  return memory;
+}
+
+/**
+ * @brief Returns the bytes the process has allocated and not yet freed.
+ */
+int64_t LinuxPlatform::heapInUse() { return ::heapInUse; }
+
+/**
+ * @brief Returns the most bytes allocated at once since the last
+ * `resetHeapPeak()`.
+ */
+int64_t LinuxPlatform::heapPeak() { return ::heapPeak; }
+
+/**
+ * @brief Starts a new peak from the bytes allocated right now.
+ */
+void LinuxPlatform::resetHeapPeak() { ::heapPeak = ::heapInUse.load(); }
+
+/**
+ * @brief Stops counting the allocations of the calling thread, such as those
+ * of synthetic clients.
+ */
+void LinuxPlatform::untrackThread() { heapUntracked = true; }
+
+/**
+ * @brief Returns a `LinuxPlatform` on the default ports with no networks.
+ */
+WiFiProvisionerPlatform &WiFiProvisionerPlatform::defaultPlatform() {
+  static LinuxPlatform platform;
+  return platform;
+}
@@ -0,0 +1,146 @@
+#ifndef LINUX_PLATFORM_H
+#define LINUX_PLATFORM_H
+
+#include "WiFiProvisionerPlatform.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Scripted radio for host builds.
+ *
+ * Scans report the networks added with `addNetwork()` once the scan duration
+ * has passed, and joining a network succeeds after the connect delay if the
+ * password matches.
+ */
+class LinuxRadio : public WiFiProvisionerPlatform::Radio {
+public:
+  LinuxRadio();
+
+  void addNetwork(const char *ssid, int32_t rssi,
+                  const char *password = nullptr, int32_t channel = 1);
+  void setScanDuration(unsigned long scanDuration);
+  void setConnectDelay(unsigned long connectDelay);
+
+  bool startAccessPoint(const char *name, const IPAddress &ip,
+                        const IPAddress &netmask) override;
+  void stopAccessPoint() override;
+  IPAddress accessPointIP() override;
+
+  bool startScan() override;
+  int16_t scanComplete() override;
+  bool scanResult(size_t index, Network &network) override;
+  void scanDelete() override;
+
+  void begin(const char *ssid, const char *password) override;
+  void disconnect() override;
+  bool isConnected() override;
+  bool link(Link &link) override;
+  void rejoin(const char *ssid, const char *password,
+              const Link &link) override;
+
+private:
+  struct Entry {
+    Network network;
+    std::string password;
+  };
+
+  static constexpr size_t NONE = static_cast<size_t>(-1);
+
+  size_t find(const char *ssid, const char *password) const;
+
+  std::vector<Entry> _networks;
+  IPAddress _apIP;
+  size_t _joined; // Index of the network being joined, `NONE` if none
+  unsigned long _scanDuration;
+  unsigned long _connectDelay;
+  unsigned long _joinDelay; // Delay of the join in progress
+  unsigned long _scanStartedAt;
+  unsigned long _connectStartedAt;
+  bool _scanning;
+  bool _scanDone;
+};
+
+/**
+ * @brief Credential store that keeps the credentials in memory and, if given
+ * a path, in a file that outlives the process.
+ */
+class LinuxCredentialStore : public WiFiProvisionerPlatform::CredentialStore {
+public:
+  LinuxCredentialStore();
+
+  void setPath(const char *path);
+
+  bool load(Credentials &credentials) override;
+  bool save(const Credentials &credentials) override;
+  void clear() override;
+
+private:
+  std::string _path;
+  Credentials _credentials;
+  bool _stored;
+};
+
+/**
+ * @brief DNS responder on a UDP socket that answers every A query with one
+ * address.
+ */
+class UdpDnsServer : public WiFiProvisionerPlatform::DnsServer {
+public:
+  explicit UdpDnsServer(uint16_t portOverride = 0);
+  ~UdpDnsServer() override;
+
+  bool start(uint16_t port, const IPAddress &ip) override;
+  void stop() override;
+  bool processNextRequest() override;
+
+private:
+  uint16_t _portOverride;
+  int _socket;
+  IPAddress _ip;
+};
+
+/**
+ * @brief Platform for running `WiFiProvisioner` on Linux.
+ *
+ * The radio is scripted, the HTTP server is the library's multiplexing
+ * `SocketHttpServer`, and the HTTP server and DNS responder listen on
+ * unprivileged ports instead of 80 and 53 unless configured otherwise.
+ *
+ * Heap use is tracked by wrapping `malloc()` and friends. `memory()` reports
+ * a heap of `setHeapSize()` bytes from which everything allocated since the
+ * platform was created has been taken, so the numbers read like an ESP32's.
+ * The stack is not tracked.
+ *
+ * Credentials are stored in memory, or in a file set with
+ * `credentialStore()->setPath()`.
+ */
+class LinuxPlatform : public WiFiProvisionerPlatform {
+public:
+  // Roughly the free heap of an ESP32 Arduino sketch before it starts Wi-Fi
+  static constexpr size_t DEFAULT_HEAP_SIZE = 300 * 1024;
+
+  explicit LinuxPlatform(uint16_t httpPort = 8080, uint16_t dnsPort = 5353);
+
+  void setHeapSize(size_t heapSize);
+
+  LinuxRadio &radio() override;
+  HttpServer *createHttpServer(uint16_t port) override;
+  DnsServer *createDnsServer() override;
+  Memory memory() override;
+  LinuxCredentialStore *credentialStore() override;
+
+  static int64_t heapInUse();
+  static int64_t heapPeak();
+  static void resetHeapPeak();
+  static void untrackThread();
+
+private:
+  LinuxRadio _radio;
+  LinuxCredentialStore _credentialStore;
+  uint16_t _httpPort;
+  uint16_t _dnsPort;
+  size_t _heapSize;
+  int64_t _heapBase; // Heap in use when the platform was created
+};
+
+#endif // LINUX_PLATFORM_H
@@ -0,0 +1,580 @@
+/**
+ * Measures request latency and throughput of the provisioning portal.
+ *
+ * Usage: portal_bench [-n iterations] [-c clients] [-k] [-p port] [-o file]
+ *
+ * The DNS responder listens on `port + 1`.
+ *
+ * Runs `WiFiProvisioner` on the Linux platform in the background and drives
+ * each scenario with `clients` concurrent synthetic clients, `iterations`
+ * iterations in total per scenario. By default every request opens a new
+ * connection and asks the server to close it. With `-k` every client keeps
+ * its connection open between requests, like a browser talking HTTP/1.1. The
+ * results are written as JSON to `file`, or to standard output by default.
+ *
+ * Most scenarios send a single request per iteration. The `session` scenario
+ * replays what a phone requests while it is being provisioned, from the first
+ * probe to the success page.
+ *
+ * For every scenario the report contains the latency percentiles of an
+ * iteration in microseconds, iterations per second, the connections opened
+ * per iteration, the bytes and `send()` system calls the server needed per
+ * response, and the most heap the portal had allocated at once beyond what it
+ * held when the scenario started. The report ends with the most connections
+ * the server had open at the same time and the portal's free heap at start,
+ * at its lowest and after shutdown, as `getMemoryStats()` reports it.
+ *
+ * Single-request scenarios also report the latency per response status, as
+ * requests of one scenario may take different paths. A `/configure` request
+ * starts a connection attempt and gets `202`. The bench sets a connection
+ * timeout of `0`, so the attempt fails within two loop iterations, and
+ * requests that arrive while it runs get `409` after the body has been
+ * parsed. These two paths are listed separately. The portal's log messages
+ * are discarded, as every failed attempt and busy `/configure` logs one.
+ *
+ * Heap use is tracked by the Linux platform's `malloc()` wrapper. Allocations
+ * of the client threads are not counted.
+ */
+#include "linux_platform.h"
+#include <Arduino.h>
+#include <WiFiProvisioner.h>
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string>
+#include <strings.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+// The /configure body names a network the radio does not know, so every job
+// fails once the connection timeout passes, and requests that arrive before
+// are answered busy after the body has been parsed. The report lists the two
+// apart.
+const char CONFIGURE_BODY[] =
+    "{\"ssid\":\"BenchNetwork\",\"password\":\"benchpassword\"}";
+
+struct Scenario {
+  const char *name;
+  std::vector<std::string> requests; // Request line and headers only
+  std::string body = CONFIGURE_BODY; // Body of POST requests
+};
+
+struct Result {
+  std::vector<uint32_t> latencies;
+  std::map<int, std::vector<uint32_t>> latenciesByStatus;
+  std::map<int, uint32_t> statuses;
+  uint32_t errors = 0;
+  uint32_t connections = 0;
+};
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief A synthetic HTTP client that optionally keeps its connection open
+ * between requests.
+ */
+class Client {
+public:
+  Client(uint16_t port, bool keepAlive)
+      : _port(port), _keepAlive(keepAlive), _fd(-1), _connections(0) {}
+
+  ~Client() { disconnect(); }
+
+  /**
+   * @brief Sends a request and reads its response.
+   *
+   * A POST request gets `body` appended. Without keep-alive the request asks
+   * the server to close the connection.
+   *
+   * @param request The request line and headers, without the blank line.
+   * @param response Receives the complete response unless `nullptr`.
+   * @param body The body of a POST request.
+   *
+   * @return The HTTP status code, or `-1` on a connection error.
+   */
+  int send(const std::string &request, std::string *response = nullptr,
+           const std::string &body = CONFIGURE_BODY) {
+    std::string message = request;
+    if (!_keepAlive) {
+      message += "Connection: close\r\n";
+    }
+    if (request.compare(0, 5, "POST ") == 0) {
+      message += "Content-Type: application/json\r\nContent-Length: ";
+      message += std::to_string(body.size());
+      message += "\r\n\r\n";
+      message += body;
+    } else {
+      message += "\r\n";
+    }
+
+    // The server may have closed an idle connection in the meantime
+    bool reused = _fd >= 0;
+    if (!reused && !connectServer()) {
+      return -1;
+    }
+    int status = exchange(message, response);
+    if (status < 0 && reused && connectServer()) {
+      status = exchange(message, response);
+    }
+    return status;
+  }
+
+  /**
+   * @brief Returns the number of connections opened so far.
+   */
+  uint32_t connections() const { return _connections; }
+
+private:
+  bool connectServer() {
+    _fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (_fd < 0) {
+      return false;
+    }
+
+    int noDelay = 1;
+    setsockopt(_fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(_port);
+    if (connect(_fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) <
+        0) {
+      disconnect();
+      return false;
+    }
+    _connections++;
+    _input.clear();
+    return true;
+  }
+
+  void disconnect() {
+    if (_fd >= 0) {
+      close(_fd);
+      _fd = -1;
+    }
+  }
+
+  bool receive() {
+    char buffer[16384];
+    ssize_t length = recv(_fd, buffer, sizeof(buffer), 0);
+    if (length <= 0) {
+      return false;
+    }
+    _input.append(buffer, length);
+    return true;
+  }
+
+  /**
+   * @brief Receives a chunked body starting at `end` and moves `end` past it.
+   * Trailers are not supported.
+   */
+  bool readChunks(size_t &end) {
+    for (;;) {
+      size_t lineEnd;
+      while ((lineEnd = _input.find("\r\n", end)) == std::string::npos) {
+        if (!receive()) {
+          return false;
+        }
+      }
+      size_t size = strtoul(_input.c_str() + end, nullptr, 16);
+      end = lineEnd + 2 + size + 2;
+      while (_input.size() < end) {
+        if (!receive()) {
+          return false;
+        }
+      }
+      if (size == 0) {
+        return true;
+      }
+    }
+  }
+
+  int exchange(const std::string &message, std::string *response) {
+    if (::send(_fd, message.data(), message.size(), MSG_NOSIGNAL) !=
+        static_cast<ssize_t>(message.size())) {
+      disconnect();
+      return -1;
+    }
+
+    size_t headerEnd;
+    while ((headerEnd = _input.find("\r\n\r\n")) == std::string::npos) {
+      if (!receive()) {
+        disconnect();
+        return -1;
+      }
+    }
+
+    int status = -1;
+    if (sscanf(_input.c_str(), "HTTP/%*d.%*d %d", &status) != 1) {
+      disconnect();
+      return -1;
+    }
+
+    std::string head = _input.substr(0, headerEnd);
+    const char *contentLength = strcasestr(head.c_str(), "Content-Length:");
+    bool chunked = strcasestr(head.c_str(), "Transfer-Encoding: chunked");
+    bool closed = !_keepAlive || strcasestr(head.c_str(), "Connection: close");
+
+    size_t end = headerEnd + 4;
+    if (chunked) {
+      if (!readChunks(end)) {
+        disconnect();
+        return -1;
+      }
+    } else if (contentLength) {
+      end += strtoul(contentLength + 15, nullptr, 10);
+      while (_input.size() < end) {
+        if (!receive()) {
+          disconnect();
+          return -1;
+        }
+      }
+    } else if (status != 204 && status != 304) {
+      // Without a length the body ends when the server closes the connection
+      while (receive()) {
+      }
+      end = _input.size();
+      closed = true;
+    }
+
+    if (response) {
+      response->assign(_input, 0, end);
+    }
+    _input.erase(0, end);
+    if (closed) {
+      disconnect();
+    }
+    return status;
+  }
+
+  uint16_t _port;
+  bool _keepAlive;
+  int _fd;
+  uint32_t _connections;
+  std::string _input;
+};
+
+uint32_t percentile(const std::vector<uint32_t> &sorted, double fraction) {
+  if (sorted.empty()) {
+    return 0;
+  }
+  size_t index = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5);
+  return sorted[index];
+}
+
+/**
+ * @brief Fetches the entity tag of the provisioning page.
+ */
+std::string fetchEtag(uint16_t port, const std::string &request) {
+  Client client(port, false);
+  std::string response;
+  client.send(request, &response);
+
+  size_t start = response.find("ETag: ");
+  if (start == std::string::npos) {
+    return "";
+  }
+  start += 6;
+  return response.substr(start, response.find("\r\n", start) - start);
+}
+
+/**
+ * @brief Fetches the version of the scan results served by `/update`.
+ */
+std::string fetchScanVersion(uint16_t port, const std::string &request) {
+  Client client(port, false);
+  std::string response;
+  client.send(request, &response);
+
+  size_t start = response.find("\"version\":");
+  if (start == std::string::npos) {
+    return "0";
+  }
+  start += 10;
+  return response.substr(start, response.find(',', start) - start);
+}
+
+/**
+ * @brief Waits until the background scan has finished so `/update` serves a
+ * full network list.
+ */
+bool waitForScan(uint16_t port) {
+  Client client(port, false);
+  for (int attempt = 0; attempt < 200; ++attempt) {
+    std::string response;
+    client.send("GET /update HTTP/1.1\r\nHost: portal\r\n", &response);
+    if (response.find("\"scanning\":false") != std::string::npos) {
+      return true;
+    }
+    delay(10);
+  }
+  return false;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  uint32_t iterations = 2000;
+  uint32_t clients = 4;
+  bool keepAlive = false;
+  uint16_t port = 18080;
+  const char *output = nullptr;
+
+  int option;
+  while ((option = getopt(argc, argv, "n:c:kp:o:")) != -1) {
+    switch (option) {
+    case 'n':
+      iterations = strtoul(optarg, nullptr, 10);
+      break;
+    case 'c':
+      clients = strtoul(optarg, nullptr, 10);
+      break;
+    case 'k':
+      keepAlive = true;
+      break;
+    case 'p':
+      port = strtoul(optarg, nullptr, 10);
+      break;
+    case 'o':
+      output = optarg;
+      break;
+    default:
+      fprintf(stderr,
+              "Usage: %s [-n iterations] [-c clients] [-k] [-p port] "
+              "[-o file]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+  if (iterations == 0 || clients == 0) {
+    fprintf(stderr, "iterations and clients must be positive\n");
+    return 2;
+  }
+
+  LinuxPlatform platform(port, port + 1);
+  LinuxRadio &radio = platform.radio();
+  for (int i = 0; i < 20; ++i) {
+    std::string ssid = "BenchNetwork" + std::to_string(i);
+    radio.addNetwork(ssid.c_str(), -40 - i * 3, i % 4 ? "password" : nullptr,
+                     1 + i % 11);
+  }
+
+  WiFiProvisioner provisioner(WiFiProvisioner::Config(), platform);
+  // Keep the loop yielding so idle back-off does not add wake-up latency
+  provisioner.setIdleBackoff(3600000, 3600000, 1);
+  provisioner.setScanCacheTtl(3600000);
+  // Every client gets a persistent connection
+  provisioner.setKeepAlive(5000, clients);
+  // Fail connection attempts at once so that /configure keeps starting them
+  provisioner.setConnectionTimeout(0, 0);
+  // Every failed attempt and busy /configure logs a message
+  provisioner.onLog([](int, const char *) {});
+  if (!provisioner.startProvisioningAsync() || !waitForScan(port)) {
+    fprintf(stderr, "Failed to start the portal on port %u\n", port);
+    provisioner.stop();
+    return 1;
+  }
+
+  const std::string root = "GET / HTTP/1.1\r\nHost: portal\r\n";
+  const std::string rootGzip = root + "Accept-Encoding: gzip, deflate\r\n";
+  const std::string update = "GET /update HTTP/1.1\r\nHost: portal\r\n";
+  const std::string configure = "POST /configure HTTP/1.1\r\nHost: portal\r\n";
+  const std::string status = "GET /status?job=1 HTTP/1.1\r\nHost: portal\r\n";
+  const std::string probe = "GET /generate_204 HTTP/1.1\r\nHost: portal\r\n";
+
+  const Scenario scenarios[] = {
+      {"root", {root}},
+      {"root_gzip", {rootGzip}},
+      {"root_revalidate",
+       {root + "If-None-Match: " + fetchEtag(port, root) + "\r\n"}},
+      {"update", {update}},
+      {"update_delta",
+       {"GET /update?since=" + fetchScanVersion(port, update) +
+        " HTTP/1.1\r\nHost: portal\r\n"}},
+      {"configure", {configure}},
+      {"configure_oversized",
+       {configure},
+       "{\"ssid\":\"BenchNetwork\",\"password\":\"" + std::string(4096, 'x') +
+           "\"}"},
+      {"generate_204", {probe}},
+      {"hotspot_detect",
+       {"GET /hotspot-detect.html HTTP/1.1\r\nHost: portal\r\n"
+        "User-Agent: CaptiveNetworkSupport-407.0.1 wispr\r\n"}},
+      {"not_found", {"GET /index.html HTTP/1.1\r\nHost: portal\r\n"}},
+      {"session",
+       {probe, rootGzip, update, update, update, configure, status, status,
+        status, probe}},
+  };
+
+  std::string report = "{\n  \"iterations\": " + std::to_string(iterations) +
+                       ",\n  \"clients\": " + std::to_string(clients) +
+                       ",\n  \"keep_alive\": " +
+                       (keepAlive ? "true" : "false") +
+                       ",\n  \"scenarios\": [";
+  bool failed = false;
+
+  for (size_t s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); ++s) {
+    const Scenario &scenario = scenarios[s];
+    std::vector<Result> results(clients);
+
+    WiFiProvisioner::ServerStats before = provisioner.getServerStats();
+    WiFiProvisioner::ResponseStats responsesBefore =
+        provisioner.getResponseStats();
+
+    int64_t heapAtStart = LinuxPlatform::heapInUse();
+    LinuxPlatform::resetHeapPeak();
+    Clock::time_point start = Clock::now();
+    std::vector<std::thread> threads;
+    for (uint32_t c = 0; c < clients; ++c) {
+      uint32_t share =
+          iterations / clients + (c < iterations % clients ? 1 : 0);
+      threads.emplace_back([&, c, share] {
+        LinuxPlatform::untrackThread();
+        Result &result = results[c];
+        Client client(port, keepAlive);
+        result.latencies.reserve(share);
+        for (uint32_t i = 0; i < share; ++i) {
+          Clock::time_point sent = Clock::now();
+          bool ok = true;
+          int code = 0;
+          for (const std::string &request : scenario.requests) {
+            code = client.send(request, nullptr, scenario.body);
+            if (code < 0) {
+              ok = false;
+              break;
+            }
+            result.statuses[code]++;
+          }
+          uint32_t latency = std::chrono::duration_cast<
+                                 std::chrono::microseconds>(Clock::now() - sent)
+                                 .count();
+          if (!ok) {
+            result.errors++;
+            continue;
+          }
+          result.latencies.push_back(latency);
+          if (scenario.requests.size() == 1) {
+            result.latenciesByStatus[code].push_back(latency);
+          }
+        }
+        result.connections = client.connections();
+      });
+    }
+    for (std::thread &thread : threads) {
+      thread.join();
+    }
+    double seconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    // Let the provisioning loop refresh its statistics snapshot
+    delay(20);
+    WiFiProvisioner::ServerStats after = provisioner.getServerStats();
+    WiFiProvisioner::ResponseStats responsesAfter =
+        provisioner.getResponseStats();
+
+    Result total;
+    for (const Result &result : results) {
+      total.latencies.insert(total.latencies.end(), result.latencies.begin(),
+                             result.latencies.end());
+      for (const auto &code : result.statuses) {
+        total.statuses[code.first] += code.second;
+      }
+      for (const auto &code : result.latenciesByStatus) {
+        std::vector<uint32_t> &latencies = total.latenciesByStatus[code.first];
+        latencies.insert(latencies.end(), code.second.begin(),
+                         code.second.end());
+      }
+      total.errors += result.errors;
+      total.connections += result.connections;
+    }
+    std::sort(total.latencies.begin(), total.latencies.end());
+    failed |= total.errors > 0;
+
+    uint32_t served = after.requests - before.requests;
+    double perResponse = served ? 1.0 / served : 0;
+    double mean = 0;
+    for (uint32_t latency : total.latencies) {
+      mean += latency;
+    }
+    mean = total.latencies.empty() ? 0 : mean / total.latencies.size();
+
+    char line[640];
+    snprintf(line, sizeof(line),
+             "%s\n    {\"name\": \"%s\", \"requests_per_iteration\": %zu, "
+             "\"completed\": %zu, \"errors\": %u, "
+             "\"p50_us\": %u, \"p99_us\": %u, \"max_us\": %u, "
+             "\"mean_us\": %.1f, \"iterations_per_sec\": %.1f, "
+             "\"connections_per_iteration\": %.2f, "
+             "\"bytes_per_response\": %.1f, \"writes_per_response\": %.2f, "
+             "\"segments_per_response\": %.2f, \"peak_heap_bytes\": %lld, "
+             "\"status\": {",
+             s ? "," : "", scenario.name, scenario.requests.size(),
+             total.latencies.size(), total.errors,
+             percentile(total.latencies, 0.50),
+             percentile(total.latencies, 0.99),
+             total.latencies.empty() ? 0 : total.latencies.back(), mean,
+             total.latencies.size() / seconds,
+             static_cast<double>(total.connections) / iterations,
+             (after.bytesWritten - before.bytesWritten) * perResponse,
+             (after.writeCalls - before.writeCalls) * perResponse,
+             (responsesAfter.segments - responsesBefore.segments) *
+                 perResponse,
+             static_cast<long long>(LinuxPlatform::heapPeak() - heapAtStart));
+    report += line;
+    bool first = true;
+    for (const auto &code : total.statuses) {
+      snprintf(line, sizeof(line), "%s\"%d\": %u", first ? "" : ", ",
+               code.first, code.second);
+      report += line;
+      first = false;
+    }
+    report += "}";
+
+    if (scenario.requests.size() == 1) {
+      report += ", \"latency_by_status\": {";
+      first = true;
+      for (auto &code : total.latenciesByStatus) {
+        std::vector<uint32_t> &latencies = code.second;
+        std::sort(latencies.begin(), latencies.end());
+        snprintf(line, sizeof(line),
+                 "%s\"%d\": {\"count\": %zu, \"p50_us\": %u, "
+                 "\"p99_us\": %u}",
+                 first ? "" : ", ", code.first, latencies.size(),
+                 percentile(latencies, 0.50), percentile(latencies, 0.99));
+        report += line;
+        first = false;
+      }
+      report += "}";
+    }
+    report += "}";
+  }
+  provisioner.stop();
+
+  WiFiProvisioner::MemoryStats memory = provisioner.getMemoryStats();
+  report += "\n  ],\n  \"peak_connections\": " +
+            std::to_string(provisioner.getServerStats().peakConnections) +
+            ",\n  \"memory\": {\"start_free_heap\": " +
+            std::to_string(memory.startFreeHeap) +
+            ", \"min_free_heap\": " + std::to_string(memory.minFreeHeap) +
+            ", \"shutdown_free_heap\": " +
+            std::to_string(memory.shutdownFreeHeap) + "}\n}\n";
+
+  FILE *file = output ? fopen(output, "w") : stdout;
+  if (!file) {
+    fprintf(stderr, "Cannot open %s\n", output);
+    return 1;
+  }
+  fputs(report.c_str(), file);
+  if (output) {
+    fclose(file);
+  }
+  return failed ? 1 : 0;
+}
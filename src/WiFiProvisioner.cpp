@@ -1,139 +1,317 @@
 #include "WiFiProvisioner.h"
-#include "internal/provision_html.h"
-#include <ArduinoJson.h>
-#include <DNSServer.h>
-#include <WebServer.h>
-#include <WiFi.h>
-
-#define WIFI_PROVISIONER_LOG_DEBUG 0
-#define WIFI_PROVISIONER_LOG_INFO 1
-#define WIFI_PROVISIONER_LOG_WARN 2
-#define WIFI_PROVISIONER_LOG_ERROR 3
-
-#define WIFI_PROVISIONER_DEBUG // Comment to hide debug prints
-
-#ifdef WIFI_PROVISIONER_DEBUG
-#define WIFI_PROVISIONER_DEBUG_LOG(level, format, ...)                         \
-  do {                                                                         \
-    if (level >= WIFI_PROVISIONER_LOG_INFO) {                                  \
-      Serial.printf("[%s] " format "\n",                                       \
-                    (level == WIFI_PROVISIONER_LOG_DEBUG)  ? "DEBUG"           \
-                    : (level == WIFI_PROVISIONER_LOG_INFO) ? "INFO"            \
-                    : (level == WIFI_PROVISIONER_LOG_WARN) ? "WARN"            \
-                                                           : "ERROR",          \
-                    ##__VA_ARGS__);                                            \
-    }                                                                          \
-  } while (0)
-#else
-#define WIFI_PROVISIONER_DEBUG_LOG(level, format, ...)                         \
-  do {                                                                         \
-  } while (0) // Empty macro
-#endif
+#include "internal/connector.h"
+#include "internal/credentials_parser.h"
+#include "internal/event_hub.h"
+#include "internal/idle_pump.h"
+#include "internal/json_stream.h"
+#include "internal/logger.h"
+#include "internal/page_cache.h"
+#include "internal/probe_classifier.h"
+#include "internal/pump_task.h"
+#include "internal/response_writer.h"
+#include "internal/route_metrics.h"
+#include "internal/scan_engine.h"
+#include <Arduino.h>
 
 namespace {
 
+using HttpServer = WiFiProvisionerPlatform::HttpServer;
+using CredentialStore = WiFiProvisionerPlatform::CredentialStore;
+
+// Content length of a body whose length is not known up front
+constexpr size_t STREAMED_LENGTH = static_cast<size_t>(-1);
+
 /**
- * @brief Converts a Received Signal Strength Indicator (RSSI) value to a signal
- * strength level.
+ * @brief Writes the `/update` response body from the cached Wi-Fi scan
+ * results.
+ *
+ * The networks are written straight from the scan engine's table, converting
+ * each signal strength to a level. It never scans by itself. For a delta,
+ * only the networks that changed after `since` are written, followed by the
+ * SSIDs removed after it.
  *
- * This function maps RSSI values to a step level ranging from 0 to 4 based on
- * predefined minimum and maximum RSSI thresholds. The returned level provides
- * an approximation of the signal quality.
+ * @param json The stream to write the JSON object to. Each network in the
+ * "network" array is an object with the following keys:
  *
- * @param rssi The RSSI value (in dBm) representing the signal strength
- * of a Wi-Fi network.
+ *            - `ssid`: The network SSID (string).
+ *
+ *            - `rssi`: The signal strength level (integer, 0 to 4).
  *
- * @return An integer in the range [0, 4], where 0 indicates very poor signal
- * strength and 4 indicates excellent signal strength.
+ *            - `authmode`: The authentication mode (0 for open, 1 for secured).
+ * @param showCode Whether the page shows the additional input field.
+ * @param scanEngine The scan engine holding the cached results.
+ * @param delta Whether to write only the changes since `since`, which the
+ * scan engine must know.
+ * @param since The version the client has.
  */
-int convertRRSItoLevel(int rssi) {
-  //  Convert RSSI to 0 - 4 Step level
-  int numlevels = 4;
-  int MIN_RSSI = -100;
-  int MAX_RSSI = -55;
-
-  if (rssi < MIN_RSSI) {
-    return 0;
-  } else if (rssi >= MAX_RSSI) {
-    return numlevels;
-  } else {
-    int inputRange = MAX_RSSI - MIN_RSSI;
-    int res = std::ceil((rssi - MIN_RSSI) * numlevels / inputRange);
-    if (res == 0) {
-      return 1;
-    } else {
-      return res;
+void writeUpdate(JsonStream &json, bool showCode, const ScanEngine &scanEngine,
+                 bool delta, uint32_t since) {
+  json.beginObject();
+  json.key("show_code").value(showCode);
+  json.key("scanning").value(scanEngine.isScanning());
+  json.key("version").value(static_cast<unsigned long>(scanEngine.version()));
+  if (delta) {
+    json.key("since").value(static_cast<unsigned long>(since));
+  }
+  json.key("network").beginArray();
+  for (size_t i = 0; i < scanEngine.count(); ++i) {
+    if (delta && scanEngine.changedIn(i) <= since) {
+      continue;
+    }
+    const ScanEngine::Network &result = scanEngine.at(i);
+    json.beginObject();
+    json.key("rssi").value(ScanEngine::signalLevel(result.rssi));
+    json.key("ssid").value(result.ssid);
+    json.key("authmode").value(result.open ? 0 : 1);
+    json.endObject();
+  }
+  json.endArray();
+  if (delta) {
+    json.key("removed").beginArray();
+    for (size_t i = 0; i < scanEngine.removedCount(); ++i) {
+      uint32_t version;
+      const char *ssid = scanEngine.removed(i, version);
+      if (version > since) {
+        json.value(ssid);
+      }
     }
+    json.endArray();
   }
+  json.endObject();
 }
 
 /**
- * @brief Scans for available Wi-Fi networks and populates a JSON document with
- * the results.
+ * @brief Writes the `/status` response body for the current connection
+ * attempt.
  *
- * This function performs a Wi-Fi network scan, collecting information about
- * each detected network, including its SSID, signal strength (converted to a
- * level), and authentication mode. The results are stored in the provided `doc`
- * JSON document under the "network" array.
+ * @param json The stream to write the JSON object to.
+ * @param connector The connector running the attempt.
+ */
+void writeStatus(JsonStream &json, const Connector &connector) {
+  Connector::State state = connector.state();
+  json.beginObject();
+  json.key("job").value(static_cast<unsigned long>(connector.id()));
+  json.key("state").value(Connector::stateName(state));
+  if (state == Connector::VERIFIED || state == Connector::FAILED) {
+    json.key("success").value(state == Connector::VERIFIED);
+  }
+  if (connector.reason()) {
+    json.key("reason").value(connector.reason());
+  }
+  json.endObject();
+}
+
+/**
+ * @brief Waits until the station is connected or the budget has run out.
  *
- * @param doc A reference to a `JsonDocument` object where the scan results will
- * be stored. The document will contain an array of networks, each represented
- * as a JSON object with the following keys:
+ * @param radio The radio joining the network.
+ * @param start When the budget started, in milliseconds.
+ * @param budget The budget in milliseconds.
  *
- *            - `ssid`: The network SSID (string).
+ * @return `true` if the station connected in time.
+ */
+bool waitForConnection(WiFiProvisionerPlatform::Radio &radio,
+                       unsigned long start, unsigned long budget) {
+  while (!radio.isConnected()) {
+    if (millis() - start >= budget) {
+      return false;
+    }
+    delay(10);
+  }
+  return true;
+}
+
+/**
+ * @brief Checks whether an `Accept-Encoding` header value allows gzip.
  *
- *            - `rssi`: The signal strength level (integer, 0 to 4).
+ * @param acceptEncoding The value of the request's `Accept-Encoding` header.
  *
- *            - `authmode`: The authentication mode (0 for open, 1 for secured).
+ * @return `true` if `gzip` is listed without being refused by `q=0`.
  */
-void networkScan(JsonDocument &doc) {
-  JsonArray networks = doc["network"].to<JsonArray>();
+bool acceptsGzip(const char *acceptEncoding) {
+  const char *token = acceptEncoding;
+  while (token && *token) {
+    while (*token == ' ' || *token == ',') {
+      ++token;
+    }
+    const char *end = strchr(token, ',');
+    size_t length = end ? static_cast<size_t>(end - token) : strlen(token);
 
-  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
-                             "Starting Network Scan...");
-  int n = WiFi.scanNetworks(false, false);
-  if (n) {
-    for (int i = 0; i < n; ++i) {
-      JsonObject network = networks.add<JsonObject>();
-      network["rssi"] = convertRRSItoLevel(WiFi.RSSI(i));
-      network["ssid"] = WiFi.SSID(i);
-      network["authmode"] = (WiFi.encryptionType(i) == WIFI_AUTH_OPEN) ? 0 : 1;
+    if (strncasecmp(token, "gzip", 4) == 0 &&
+        (length == 4 || token[4] == ';' || token[4] == ' ')) {
+      const char *q = strstr(token, "q=");
+      return q == nullptr || q >= token + length || atof(q + 2) > 0;
     }
+    token = end;
+  }
+  return false;
+}
+
+/**
+ * @brief Returns the HTTP reason phrase for a status code.
+ */
+const char *statusText(int statusCode) {
+  switch (statusCode) {
+  case 200:
+    return "OK";
+  case 202:
+    return "Accepted";
+  case 302:
+    return "Found";
+  case 304:
+    return "Not Modified";
+  case 400:
+    return "Bad Request";
+  case 404:
+    return "Not Found";
+  case 409:
+    return "Conflict";
+  case 413:
+    return "Payload Too Large";
+  case 503:
+    return "Service Unavailable";
+  default:
+    return "Error";
+  }
+}
+
+/**
+ * @brief Checks whether an `If-None-Match` header value matches an entity tag.
+ *
+ * Uses the weak comparison required for `If-None-Match`, so `W/` prefixes are
+ * ignored.
+ *
+ * @param ifNoneMatch The value of the request's `If-None-Match` header.
+ * @param etag The quoted entity tag of the current representation.
+ *
+ * @return `true` if the header lists the tag or is `*`.
+ */
+bool matchesEtag(const char *ifNoneMatch, const char *etag) {
+  size_t etagLength = strlen(etag);
+  const char *token = ifNoneMatch;
+  while (token && *token) {
+    while (*token == ' ' || *token == ',') {
+      ++token;
+    }
+    if (strncmp(token, "W/", 2) == 0) {
+      token += 2;
+    }
+    if (*token == '*' ||
+        (strncmp(token, etag, etagLength) == 0 &&
+         (token[etagLength] == '\0' || token[etagLength] == ',' ||
+          token[etagLength] == ' '))) {
+      return true;
+    }
+    token = strchr(token, ',');
+  }
+  return false;
+}
+
+/**
+ * @brief Appends a `Name: value` line to a header buffer if it fits.
+ */
+void appendHeader(char *buffer, size_t size, size_t &length, const char *name,
+                  const char *value) {
+  int written =
+      snprintf(buffer + length, size - length, "%s: %s\r\n", name, value);
+  if (written > 0 && length + written < size) {
+    length += written;
   }
-  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
-                             "Network scan complete");
 }
 
 /**
  * @brief Sends an HTTP header response to the client.
  *
- * This function constructs and sends the HTTP response header to the connected
- * client, specifying the HTTP status code, content type, and content length.
+ * This function constructs the HTTP response header and appends it to the
+ * response, specifying the HTTP status code, content type, and content length.
+ * Responses with an entity tag are sent with `Cache-Control: no-cache` so that
+ * clients revalidate them, all others with `Cache-Control: no-store`. The
+ * connection is kept open if the server allows it for the current request.
  *
- * @param client A reference to the `WiFiClient` object representing the
- * connected client.
+ * @param response The response of the current request.
  * @param statusCode The HTTP status code (e.g., 200 for success, 404 for not
  * found).
  * @param contentType The MIME type of the content (e.g., "text/html",
- * "application/json").
+ * "application/json"), or `nullptr` for a response without a body.
  * @param contentLength The size of the content in bytes to be sent in the
- * response.
+ * response, or `STREAMED_LENGTH` for a chunked body.
+ * @param contentEncoding The `Content-Encoding` of the body (e.g., "gzip"), or
+ * `nullptr` for an unencoded body.
+ * @param etag The quoted entity tag of the body, or `nullptr`.
  */
-void sendHeader(WiFiClient &client, int statusCode, const char *contentType,
-                size_t contentLength) {
-  client.print("HTTP/1.0 ");
-  client.print(statusCode);
-  client.println(" OK");
-
-  client.print("Content-Type: ");
-  client.println(contentType);
-
-  client.print("Content-Length: ");
-  client.println(contentLength);
+void sendHeader(ResponseWriter &response, int statusCode,
+                const char *contentType, size_t contentLength,
+                const char *contentEncoding = nullptr,
+                const char *etag = nullptr) {
+  response.setStatus(statusCode);
+
+  char header[320];
+  size_t length = 0;
+  int written = snprintf(header, sizeof(header), "HTTP/1.1 %d %s\r\n",
+                         statusCode, statusText(statusCode));
+  if (written <= 0) {
+    return;
+  }
+  length = written;
+
+  if (contentType) {
+    appendHeader(header, sizeof(header), length, "Content-Type", contentType);
+    if (contentLength != STREAMED_LENGTH) {
+      char contentLengthText[12];
+      snprintf(contentLengthText, sizeof(contentLengthText), "%u",
+               static_cast<unsigned>(contentLength));
+      appendHeader(header, sizeof(header), length, "Content-Length",
+                   contentLengthText);
+    } else if (response.beginChunked()) {
+      appendHeader(header, sizeof(header), length, "Transfer-Encoding",
+                   "chunked");
+    }
+  }
+  if (contentEncoding) {
+    appendHeader(header, sizeof(header), length, "Content-Encoding",
+                 contentEncoding);
+  }
+  if (etag) {
+    appendHeader(header, sizeof(header), length, "ETag", etag);
+    appendHeader(header, sizeof(header), length, "Cache-Control", "no-cache");
+    appendHeader(header, sizeof(header), length, "Vary", "Accept-Encoding");
+  } else {
+    appendHeader(header, sizeof(header), length, "Cache-Control", "no-store");
+  }
+  appendHeader(header, sizeof(header), length, "Connection",
+               response.server().keepAlive() ? "keep-alive" : "close");
 
-  client.println("Connection: close");
+  if (length + 2 < sizeof(header)) {
+    header[length++] = '\r';
+    header[length++] = '\n';
+    response.writeHeader(header, length);
+  }
+}
 
-  client.println();
+/**
+ * @brief Sends a `302 Found` response without a body that sends the client to
+ * the provisioning page.
+ *
+ * @param response The response of the current request.
+ * @param ip The address of the access point serving the page.
+ */
+void sendRedirect(ResponseWriter &response, const IPAddress &ip) {
+  response.setStatus(302);
+
+  char header[192];
+  int written = snprintf(
+      header, sizeof(header),
+      "HTTP/1.1 302 Found\r\n"
+      "Location: http://%u.%u.%u.%u/\r\n"
+      "Content-Length: 0\r\n"
+      "Cache-Control: no-store\r\n"
+      "Connection: %s\r\n"
+      "\r\n",
+      ip[0], ip[1], ip[2], ip[3],
+      response.server().keepAlive() ? "keep-alive" : "close");
+  if (written > 0 && static_cast<size_t>(written) < sizeof(header)) {
+    response.writeHeader(header, written);
+  }
 }
 
 } // namespace
@@ -229,6 +407,21 @@ WiFiProvisioner::Config::Config(const char *apName, const char *htmlTitle,
       INPUT_LENGTH(inputLength), SHOW_INPUT_FIELD(showInputField),
       SHOW_RESET_FIELD(showResetField) {}
 
+/**
+ * @brief Constructor for the `WiFiProvisioner::TaskOptions` struct.
+ *
+ * Describes the task that serves the captive portal when provisioning is
+ * started with `startProvisioningAsync()`.
+ *
+ * @param stackSize The stack size of the task in bytes. Defaults to 8192.
+ * @param priority The FreeRTOS priority of the task. Defaults to 1.
+ * @param core The core to pin the task to, or `-1` (default) to let the
+ * scheduler choose.
+ */
+WiFiProvisioner::TaskOptions::TaskOptions(uint32_t stackSize,
+                                          unsigned priority, int core)
+    : stackSize(stackSize), priority(priority), core(core) {}
+
 /**
  * @brief Constructs a new `WiFiProvisioner` instance with the specified
  * configuration.
@@ -269,12 +462,55 @@ WiFiProvisioner::Config::Config(const char *apName, const char *htmlTitle,
  * ```
  */
 WiFiProvisioner::WiFiProvisioner(const Config &config)
-    : _config(config), _server(nullptr), _dnsServer(nullptr),
-      _apIP(192, 168, 4, 1), _netMsk(255, 255, 255, 0), _dnsPort(53),
-      _serverPort(80), _wifiDelay(100), _wifiConnectionTimeout(10000),
-      _serverLoopFlag(false) {}
+    : WiFiProvisioner(config, WiFiProvisionerPlatform::defaultPlatform()) {}
+
+/**
+ * @brief Constructs a new `WiFiProvisioner` instance running on the given
+ * platform.
+ *
+ * The platform provides the radio, HTTP server and DNS responder used by the
+ * provisioning process. Use this constructor to run the provisioning logic on
+ * something other than the ESP32 core, for example the Linux backend in
+ * `extras/host`.
+ *
+ * @param config A reference to a `WiFiProvisioner::Config` structure containing
+ * the configuration for the WiFi provisioning process.
+ * @param platform The platform to run on. It must outlive the instance.
+ */
+WiFiProvisioner::WiFiProvisioner(const Config &config,
+                                 WiFiProvisionerPlatform &platform)
+    : _config(config), _platform(platform), _server(nullptr),
+      _dnsServer(nullptr), _pageCache(new PageCache()),
+      _scanEngine(new ScanEngine(platform.radio())),
+      _connector(new Connector(platform.radio())), _pumpTask(new PumpTask()),
+      _idlePump(new IdlePump()), _routeMetrics(new RouteMetrics()),
+      _eventHub(new EventHub()), _apIP(192, 168, 4, 1),
+      _netMsk(255, 255, 255, 0), _dnsPort(53), _serverPort(80),
+      _wifiDelay(100), _wifiConnectionTimeout(10000), _serverLoopFlag(false),
+      _provisioning(false), _configInvalidated(false), _provisioned(false),
+      _requestHandled(false), _shutdownGracePeriod(7000),
+      _reconnectBudget(10000), _reconnectStats(),
+      _keepAliveTimeout(5000), _keepAliveConnections(4), _serverStats(),
+      _responseStats(), _probeStats(), _memoryStats(), _responseSnapshot(),
+      _probeSnapshot(), _eventSnapshot(), _pageCacheSnapshot(),
+      _statsEndpoint(false),
+      _successAt(0), _shutdownPending(false), _publishedScanVersion(0),
+      _publishedJob(0), _publishedState(Connector::IDLE) {
+  _connector->setTimeout(_wifiConnectionTimeout);
+  _connector->setSettleDelay(_wifiDelay);
+}
 
-WiFiProvisioner::~WiFiProvisioner() { releaseResources(); }
+WiFiProvisioner::~WiFiProvisioner() {
+  stop();
+  delete _pumpTask;
+  releaseResources();
+  delete _pageCache;
+  delete _scanEngine;
+  delete _connector;
+  delete _idlePump;
+  delete _routeMetrics;
+  delete _eventHub;
+}
 
 /**
  * @brief Provides access to the configuration structure.
@@ -301,6 +537,47 @@ WiFiProvisioner::~WiFiProvisioner() { releaseResources(); }
  */
 WiFiProvisioner::Config &WiFiProvisioner::getConfig() { return _config; }
 
+/**
+ * @brief Marks the configuration out of date while the portal runs.
+ *
+ * The provisioning page is rendered from the configuration once per session
+ * and served from that snapshot. After this call the provisioning loop runs
+ * the `onProvision` callback again on its next iteration, which may update
+ * the configuration through `getConfig()`, and renders the page anew. It is
+ * safe to call from any task. A factory reset from the portal invalidates
+ * the configuration as well.
+ *
+ * Example:
+ * ```
+ * void onApiKeyChanged() {
+ *   provisioner.invalidateConfig();
+ * }
+ * ```
+ */
+void WiFiProvisioner::invalidateConfig() { _configInvalidated = true; }
+
+/**
+ * @brief Returns statistics about the rendered provisioning page cache.
+ *
+ * The page is rendered once into a contiguous buffer and served from there
+ * until the configuration changes. A hit is a page request served straight
+ * from the buffer, a miss is one that had to render the page first.
+ *
+ * @return A `PageCacheStats` structure with the rendered page size in bytes and
+ * the hit and miss counts.
+ *
+ * Example Usage:
+ * ```
+ * WiFiProvisioner::PageCacheStats stats = provisioner.getPageCacheStats();
+ * Serial.printf("Page: %u bytes, %u hits, %u misses\n", stats.size,
+ *               stats.hits, stats.misses);
+ * ```
+ */
+WiFiProvisioner::PageCacheStats WiFiProvisioner::getPageCacheStats() const {
+  std::lock_guard<PumpTask> guard(*_pumpTask);
+  return _pageCacheSnapshot;
+}
+
 /**
  * @brief Releases resources allocated during the provisioning process.
  *
@@ -328,10 +605,30 @@ void WiFiProvisioner::releaseResources() {
     _dnsServer = nullptr;
   }
 
+  // Event streams, closed with the server
+  _eventHub->reset();
+
+  // Page cache
+  _pageCache->release();
+
+  // Scan results and connection job
+  _scanEngine->release();
+  _connector->reset();
+  _shutdownPending = false;
+
   // WiFi
-  if (WiFi.getMode() != WIFI_STA) {
-    WiFi.mode(WIFI_STA);
-    delay(_wifiDelay);
+  _platform.radio().stopAccessPoint();
+}
+
+/**
+ * @brief Runs the provision callback so that the application can update the
+ * configuration, and renders the page from it again on the next request.
+ */
+void WiFiProvisioner::refreshConfig() {
+  _configInvalidated = false;
+  _pageCache->invalidate();
+  if (provisionCallback) {
+    provisionCallback();
   }
 }
 
@@ -349,7 +646,8 @@ void WiFiProvisioner::releaseResources() {
  * 3. Once connected, the provisioning page should open automatically. If it
  * does not, open a web browser and navigate to `192.168.4.1`.
  *
- * @return `true` if provisioning was successful `false` otherwise.
+ * @return `true` if provisioning was successful `false` otherwise, including
+ * when provisioning is stopped with `stop()`.
  *
  * Example Usage:
  * ```
@@ -364,91 +662,433 @@ void WiFiProvisioner::releaseResources() {
  * behavior and appearance of the provisioning system.
  */
 bool WiFiProvisioner::startProvisioning() {
-  WiFi.disconnect(false, true);
-  delay(_wifiDelay);
+  if (isProvisioning()) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
+                               "Provisioning is already running");
+    return false;
+  }
 
-  releaseResources();
+  if (!beginProvisioning()) {
+    flushLog(Logger::CAPACITY);
+    return false;
+  }
 
-  _server = new WebServer(_serverPort);
-  _dnsServer = new DNSServer();
+  loop();
+  return finishProvisioning();
+}
 
-  if (!WiFi.mode(WIFI_AP_STA)) {
-    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR,
-                               "Failed to switch to AP+STA mode");
+/**
+ * @brief Starts the provisioning process in a background task and returns at
+ * once.
+ *
+ * The Access Point, DNS server and web server are set up before this method
+ * returns, and the captive portal is then served by a dedicated FreeRTOS task,
+ * so that the application's own `loop()` keeps running during provisioning.
+ * Use `isProvisioning()` to poll the state, `stop()` to abort, and
+ * `onComplete()` to be notified when provisioning ends.
+ *
+ * @param options The stack size, priority and core of the provisioning task.
+ *
+ * @return `true` if the portal was started, `false` if provisioning is already
+ * running or the portal or task could not be started.
+ *
+ * Example Usage:
+ * ```
+ * provisioner.onComplete([](bool success) {
+ *   Serial.printf("Provisioning finished: %s\n", success ? "ok" : "aborted");
+ * });
+ * provisioner.startProvisioningAsync({8192, 1, 0}); // 8 KB stack on core 0
+ * ```
+ *
+ * @note
+ * - Callbacks, including `onComplete`, run on the provisioning task, except
+ * for the first `onProvision`, which runs before this method returns.
+ * - Modify the configuration from the callbacks, or before starting, while
+ * the portal runs in the background.
+ */
+bool WiFiProvisioner::startProvisioningAsync(const TaskOptions &options) {
+  if (isProvisioning()) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
+                               "Provisioning is already running");
+    return false;
+  }
+
+  if (!beginProvisioning()) {
+    flushLog(Logger::CAPACITY);
     return false;
   }
-  delay(_wifiDelay);
 
-  if (!WiFi.softAPConfig(_apIP, _apIP, _netMsk)) {
+  bool started = _pumpTask->start(
+      [this]() {
+        loop();
+        finishProvisioning();
+      },
+      options.stackSize, options.priority, options.core);
+  if (!started) {
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR,
-                               "Failed to configure AP IP settings");
+                               "Failed to start provisioning task");
+    releaseResources();
+    _provisioning = false;
+    flushLog(Logger::CAPACITY);
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Joins the network whose credentials were stored by the last
+ * successful provisioning, without starting the portal.
+ *
+ * The station first joins the stored access point on its stored channel,
+ * which skips the scan of all channels, with the address of its last lease
+ * if the system clock shows the lease has not ended, which skips DHCP. If that has not connected within half of the reconnect
+ * budget, for example because the access point moved to another channel, the
+ * network is joined normally for the rest of the budget. The stored access
+ * point and lease are refreshed after connecting.
+ *
+ * @return `true` if the station is connected, `false` if no credentials are
+ * stored, the platform cannot store them, or the budget ran out.
+ *
+ * Example:
+ * ```
+ * if (!provisioner.reconnect()) {
+ *   provisioner.startProvisioningAsync();
+ * }
+ * ```
+ *
+ * @note `getReconnectStats()` reports how long joining took.
+ */
+bool WiFiProvisioner::reconnect() {
+  _reconnectStats = ReconnectStats();
+  if (isProvisioning()) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
+                               "Provisioning is already running");
+    return false;
+  }
+
+  CredentialStore *store = _platform.credentialStore();
+  CredentialStore::Credentials credentials;
+  if (store == nullptr || !store->load(credentials)) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
+                               "No stored credentials");
+    flushLog(Logger::CAPACITY);
+    return false;
+  }
+  _reconnectStats.stored = true;
+
+  WiFiProvisionerPlatform::Radio &radio = _platform.radio();
+  const char *password =
+      credentials.password[0] != '\0' ? credentials.password : nullptr;
+  unsigned long start = millis();
+  bool connected = false;
+
+  if (credentials.link.channel > 0) {
+    radio.rejoin(credentials.ssid, password, credentials.link);
+    connected = waitForConnection(radio, start, _reconnectBudget / 2);
+    _reconnectStats.fastPath = connected;
+  }
+  if (!connected) {
+    radio.disconnect();
+    radio.begin(credentials.ssid, password);
+    connected = waitForConnection(radio, start, _reconnectBudget);
+  }
+  _reconnectStats.connected = connected;
+  _reconnectStats.timeToConnected = millis() - start;
+
+  if (!connected) {
+    radio.disconnect();
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
+                               "Failed to reconnect to SSID: %s",
+                               credentials.ssid);
+    flushLog(Logger::CAPACITY);
     return false;
   }
-  if (!WiFi.softAP(_config.AP_NAME)) {
+
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
+                             "Reconnected to SSID: %s in %lu ms (%s)",
+                             credentials.ssid,
+                             _reconnectStats.timeToConnected,
+                             _reconnectStats.fastPath ? "fast" : "full");
+  storeCredentials(credentials.ssid, password);
+  flushLog(Logger::CAPACITY);
+  return true;
+}
+
+/**
+ * @brief Joins the stored network, or starts the portal if that fails.
+ *
+ * Replaces the usual boot sequence of loading credentials, joining and
+ * waiting, and provisioning on failure. The portal is only started once
+ * `reconnect()` has used up the reconnect budget.
+ *
+ * @return `true` if the device is connected, either to the stored network or
+ * through the portal.
+ *
+ * Example:
+ * ```
+ * void setup() {
+ *   provisioner.setReconnectBudget(5000).connect();
+ * }
+ * ```
+ */
+bool WiFiProvisioner::connect() { return reconnect() || startProvisioning(); }
+
+/**
+ * @brief Erases the stored credentials, so that the next `connect()` starts
+ * the portal. A factory reset from the portal also erases them.
+ */
+void WiFiProvisioner::clearCredentials() {
+  CredentialStore *store = _platform.credentialStore();
+  if (store) {
+    store->clear();
+  }
+}
+
+/**
+ * @brief Returns whether the captive portal is currently running.
+ *
+ * @return `true` from the start of provisioning until the portal has shut
+ * down.
+ */
+bool WiFiProvisioner::isProvisioning() const { return _provisioning; }
+
+/**
+ * @brief Aborts a running provisioning process.
+ *
+ * The portal shuts down at its next loop iteration, and `startProvisioning()`
+ * returns `false`. When provisioning runs in the background, this method waits
+ * until the task has released its resources, unless it is called from one of
+ * the callbacks running on that task.
+ */
+void WiFiProvisioner::stop() {
+  _serverLoopFlag = true;
+  _pumpTask->join();
+}
+
+/**
+ * @brief Sets up the Access Point, DNS server and web server.
+ *
+ * @return `true` if the portal is ready to be served, `false` otherwise.
+ */
+bool WiFiProvisioner::beginProvisioning() {
+  WiFiProvisionerPlatform::Radio &radio = _platform.radio();
+  radio.disconnect();
+  delay(_wifiDelay);
+
+  releaseResources();
+  refreshConfig();
+
+  // The baseline is taken before the portal allocates anything
+  _memoryStats = MemoryStats();
+  WiFiProvisionerPlatform::Memory memory = sampleMemory(false);
+  _memoryStats.startFreeHeap = memory.freeHeap;
+  _memoryStats.startLargestFreeBlock = memory.largestFreeBlock;
+
+  _server = _platform.createHttpServer(_serverPort);
+  _server->setKeepAlive(_keepAliveTimeout, _keepAliveConnections);
+  _server->setMaxBodySize(WIFI_PROVISIONER_MAX_BODY_SIZE);
+  _responseStats = ResponseStats();
+  _probeStats = ProbeStats();
+  _eventHub->clearStats();
+  {
+    std::lock_guard<PumpTask> guard(*_pumpTask);
+    _serverStats = ServerStats();
+  }
+  publishStats();
+  _publishedScanVersion = _scanEngine->version();
+  _publishedJob = _connector->id();
+  _publishedState = _connector->state();
+  _dnsServer = _platform.createDnsServer();
+
+  if (!radio.startAccessPoint(_config.AP_NAME, _apIP, _netMsk)) {
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR,
                                "Failed to start Access Point");
     return false;
   }
-  delay(_wifiDelay);
 
-  _dnsServer->setErrorReplyCode(DNSReplyCode::NoError);
-  if (!_dnsServer->start(_dnsPort, "*", _apIP)) {
+  if (!_dnsServer->start(_dnsPort, _apIP)) {
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR,
                                "Failed to start DNS server");
     return false;
   }
 
-  _server->on("/", [this]() { this->handleRootRequest(); });
-  _server->on("/configure", HTTP_POST,
-              [this]() { this->handleConfigureRequest(); });
-  _server->on("/update", [this]() { this->handleUpdateRequest(); });
-  _server->on("/generate_204", [this]() { this->handleRootRequest(); });
-  _server->on("/fwlink", [this]() { this->handleRootRequest(); });
-  _server->on("/factoryreset", HTTP_POST,
-              [this]() { this->handleResetRequest(); });
-  _server->onNotFound([this]() { this->handleRootRequest(); });
+  // Every route records that a request was handled in this loop iteration,
+  // samples the memory before and after the handler, and counts the request
+  // in the route's metrics
+  _routeMetrics->clear();
+  auto route = [this](const char *path, void (WiFiProvisioner::*handler)()) {
+    size_t index = _routeMetrics->add(path);
+    return [this, handler, index]() {
+      _requestHandled = true;
+      sampleMemory(true);
+      ResponseStats before = _responseStats;
+      unsigned long start = micros();
+      (this->*handler)();
+      _routeMetrics->record(index, micros() - start,
+                            _responseStats.errors != before.errors,
+                            _responseStats.bytes - before.bytes);
+      sampleMemory(true);
+    };
+  };
+
+  _server->on("/", HttpServer::ANY,
+              route("/", &WiFiProvisioner::handleRootRequest));
+  _server->on("/configure", HttpServer::POST,
+              route("/configure", &WiFiProvisioner::handleConfigureRequest));
+  _server->on("/update", HttpServer::ANY,
+              route("/update", &WiFiProvisioner::handleUpdateRequest));
+  _server->on("/status", HttpServer::ANY,
+              route("/status", &WiFiProvisioner::handleStatusRequest));
+  _server->on("/events", HttpServer::GET,
+              route("/events", &WiFiProvisioner::handleEventsRequest));
+  _server->on("/complete", HttpServer::POST,
+              route("/complete", &WiFiProvisioner::handleCompleteRequest));
+  _server->on("/generate_204", HttpServer::ANY,
+              route("/generate_204", &WiFiProvisioner::handleProbeRequest));
+  _server->on("/fwlink", HttpServer::ANY,
+              route("/fwlink", &WiFiProvisioner::handleProbeRequest));
+  _server->on("/factoryreset", HttpServer::POST,
+              route("/factoryreset", &WiFiProvisioner::handleResetRequest));
+  if (_statsEndpoint) {
+    _server->on("/stats", HttpServer::GET,
+                route("/stats", &WiFiProvisioner::handleStatsRequest));
+  }
+  _server->onNotFound(route("*", &WiFiProvisioner::handleProbeRequest));
+
+  const char *headerKeys[] = {"Accept-Encoding", "If-None-Match",
+                              "User-Agent"};
+  _server->collectHeaders(headerKeys, sizeof(headerKeys) / sizeof(char *));
+
+  if (!_scanEngine->allocate()) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR,
+                               "Failed to allocate scan results");
+    return false;
+  }
+
+  if (!_scanEngine->start()) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
+                               "Failed to start network scan");
+  }
+
+  if (!_pageCache->render(_config)) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
+                               "Failed to allocate page cache, streaming page");
+  }
+
+  if (!_server->begin()) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR,
+                               "Failed to start web server");
+    return false;
+  }
 
-  _server->begin();
+  IPAddress ip = radio.accessPointIP();
   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
-                             "Provision server started at %s",
-                             WiFi.softAPIP().toString());
+                             "Provision server started at %u.%u.%u.%u", ip[0],
+                             ip[1], ip[2], ip[3]);
 
-  loop();
+  _provisioned = false;
+  _provisioning = true;
   return true;
 }
 
+/**
+ * @brief Marks provisioning as finished and invokes the completion callback.
+ *
+ * @return `true` if the device was provisioned, `false` if provisioning was
+ * stopped.
+ */
+bool WiFiProvisioner::finishProvisioning() {
+  bool provisioned = _provisioned;
+  _provisioning = false;
+
+  if (onCompleteCallback) {
+    onCompleteCallback(provisioned);
+  }
+  return provisioned;
+}
+
 /**
  * @brief Handles the main loop for the Wi-Fi provisioning process.
  *
  * This function continuously processes DNS and HTTP server requests while the
  * provisioning process is active. It ensures that DNS requests are resolved to
  * redirect clients to the provisioning page and handles HTTP client
- * interactions.
+ * interactions. It also collects the results of background Wi-Fi scans,
+ * advances a pending connection attempt and sends what changed to the
+ * `/events` streams.
+ *
+ * Between iterations the loop yields while clients are active, and backs off
+ * to short and then longer sleeps once no traffic has been seen for a while,
+ * instead of spinning at full CPU load.
  *
  * The loop runs until the `_serverLoopFlag` is set to `true`, indicating that
  * provisioning is complete or the server needs to shut down.
  */
 void WiFiProvisioner::loop() {
+  _idlePump->reset();
+  sampleMemory(true);
+
   while (!_serverLoopFlag) {
-    // DNS
-    if (_dnsServer) {
-      _dnsServer->processNextRequest();
+    unsigned long iterationStart = micros();
+    _requestHandled = false;
+
+    // Configuration
+    if (_configInvalidated) {
+      refreshConfig();
     }
 
+    // DNS
+    bool dnsActive = _dnsServer && _dnsServer->processNextRequest();
+
     // HTTP
     if (_server) {
       _server->handleClient();
     }
+
+    // Scan
+    _scanEngine->poll();
+
+    // Connection
+    advanceConnection();
+
+    // Event streams
+    publishEvents();
+
+    // Statistics
+    publishStats();
+
+    // Back off while no client is talking to the portal, and print the log
+    // then. Under sustained traffic the log is drained down to a quarter
+    // whenever it is half full, so that it does not overflow
+    bool active = dnsActive || _requestHandled ||
+                  (_server && _server->clientConnected());
+    if (!active) {
+      flushLog(Logger::CAPACITY);
+    } else if (Logger::pending() >= Logger::CAPACITY / 2) {
+      flushLog(Logger::pending() - Logger::CAPACITY / 4);
+    }
+    _idlePump->wait(active, micros() - iterationStart);
   }
   releaseResources();
+  publishStats();
+
+  WiFiProvisionerPlatform::Memory memory = sampleMemory(true);
+  {
+    std::lock_guard<PumpTask> guard(*_pumpTask);
+    _memoryStats.shutdownFreeHeap = memory.freeHeap;
+    _memoryStats.shutdownLargestFreeBlock = memory.largestFreeBlock;
+  }
+  flushLog(Logger::CAPACITY);
 }
 
 /**
  * @brief Registers a callback function to handle provisioning events.
  *
- * This callback is invoked whenever provisioning starts, allowing the user
- * to, for example, dynamically adjust the configuration (e.g., showing or
- * hiding the input field)
+ * This callback is invoked once when provisioning starts, before the page is
+ * rendered, allowing the user to, for example, dynamically adjust the
+ * configuration (e.g., showing or hiding the input field). It is invoked
+ * again after `invalidateConfig()` or a factory reset, but not for every
+ * page request, so it may read settings from flash.
  *
  * @param callback A callable object or lambda that performs operations when
  * provisioning starts.
@@ -472,6 +1112,30 @@ WiFiProvisioner &WiFiProvisioner::onProvision(ProvisionCallback callback) {
   return *this;
 }
 
+/**
+ * @brief Registers a callback function invoked whenever a browser requests
+ * the provisioning page.
+ *
+ * Connectivity checks of the operating system and revalidations answered
+ * with `304 Not Modified` do not count as page views. The page is served from the configuration snapshot taken when provisioning
+ * started, so the callback should not modify the configuration. Call
+ * `invalidateConfig()` instead to have `onProvision` run again.
+ *
+ * @param callback A callable object or lambda invoked before the page is
+ * sent.
+ *
+ * @return A reference to the `WiFiProvisioner` instance for method chaining.
+ *
+ * Example:
+ * ```
+ * provisioner.onPageView([]() { Serial.println("Portal opened"); });
+ * ```
+ */
+WiFiProvisioner &WiFiProvisioner::onPageView(PageViewCallback callback) {
+  pageViewCallback = std::move(callback);
+  return *this;
+}
+
 /**
  * @brief Registers a callback function to validate user input during
  * provisioning.
@@ -565,70 +1229,539 @@ WiFiProvisioner &WiFiProvisioner::onSuccess(SuccessCallback callback) {
 }
 
 /**
- * @brief Handles the HTTP `/` request.
+ * @brief Registers a callback function invoked when provisioning ends.
  *
- * This function responds to the root URL (`/`) by sending an HTML page
- * composed of several predefined fragments and dynamic content based on the
- * Wi-Fi provisioning configuration.
+ * The callback is invoked after the portal has shut down and released its
+ * resources, both for `startProvisioning()` and `startProvisioningAsync()`.
+ * For the latter it runs on the provisioning task.
  *
- */
+ * @param callback A callable object or lambda that accepts a `bool` which is
+ * `true` if the device was provisioned, or `false` if provisioning was
+ * stopped.
+ *
+ * @return A reference to the `WiFiProvisioner` instance for method chaining.
+ *
+ * Example:
+ * ```
+ * provisioner.onComplete([](bool success) {
+ *     Serial.printf("Provisioning %s\n", success ? "succeeded" : "stopped");
+ * });
+ * ```
+ */
+WiFiProvisioner &WiFiProvisioner::onComplete(CompleteCallback callback) {
+  onCompleteCallback = std::move(callback);
+  return *this;
+}
+
+/**
+ * @brief Registers a callback function that receives the library's log
+ * messages instead of `Serial`.
+ *
+ * Messages are queued in a ring buffer of `WIFI_PROVISIONER_LOG_BUFFER_SIZE`
+ * entries when they are logged, and formatted and passed on while the portal
+ * is idle, or in a batch between requests once the buffer is half full, so
+ * slow output does not delay the request that logged. Messages below
+ * `WIFI_PROVISIONER_LOG_LEVEL` are not compiled in.
+ *
+ * @param callback A callable object or lambda that accepts the level, one of
+ * the `WIFI_PROVISIONER_LOG_*` constants, and the message without a trailing
+ * newline. It runs on the task serving the portal.
+ *
+ * @return A reference to the `WiFiProvisioner` instance for method chaining.
+ *
+ * Example:
+ * ```
+ * provisioner.onLog([](int level, const char *message) {
+ *     if (level >= WIFI_PROVISIONER_LOG_WARN) {
+ *         Serial1.println(message);
+ *     }
+ * });
+ * ```
+ */
+WiFiProvisioner &WiFiProvisioner::onLog(LogCallback callback) {
+  logCallback = std::move(callback);
+  return *this;
+}
+
+/**
+ * @brief Sets how long Wi-Fi scan results are served from the cache.
+ *
+ * A scan is started in the background when provisioning begins, and the
+ * `/update` endpoint answers from its cached results at once. Once the results
+ * are older than `ttl`, the next `/update` request starts a new background
+ * scan while still answering with the previous results. Defaults to 10
+ * seconds.
+ *
+ * @param ttl The time to live of the scan results in milliseconds.
+ *
+ * @return A reference to the `WiFiProvisioner` instance for method chaining.
+ *
+ * Example:
+ * ```
+ * provisioner.setScanCacheTtl(30000); // Rescan at most every 30 seconds
+ * ```
+ */
+WiFiProvisioner &WiFiProvisioner::setScanCacheTtl(unsigned long ttl) {
+  _scanEngine->setTtl(ttl);
+  return *this;
+}
+
+/**
+ * @brief Sets how many networks the page lists.
+ *
+ * Each scan is reduced on the device before it is cached: hidden networks
+ * are dropped, an SSID announced by several access points, as mesh and
+ * multi-BSSID networks do, is listed once with its strongest signal, and the
+ * strongest `limit` networks are kept, sorted by signal strength. Defaults
+ * to and is capped at `WIFI_PROVISIONER_MAX_NETWORKS`.
+ *
+ * @param limit The most networks served by `/update`. Takes effect with the
+ * next scan.
+ *
+ * @return A reference to the `WiFiProvisioner` instance for method chaining.
+ *
+ * Example:
+ * ```
+ * provisioner.setScanLimit(10); // List the 10 strongest networks
+ * ```
+ */
+WiFiProvisioner &WiFiProvisioner::setScanLimit(size_t limit) {
+  _scanEngine->setLimit(limit);
+  return *this;
+}
+
+/**
+ * @brief Sets how long the portal keeps running after a successful connection.
+ *
+ * After the device has connected and the input has been validated, the portal
+ * keeps serving requests for the grace period so that the page can show the
+ * success message. `startProvisioning()` returns when the grace period has
+ * passed, or as soon as the page confirms it has shown the success message.
+ * A grace period of zero shuts the portal down right after the connection
+ * succeeds, in which case the page may not get to show the success message.
+ * Defaults to 7 seconds.
+ *
+ * @param gracePeriod The grace period in milliseconds.
+ *
+ * @return A reference to the `WiFiProvisioner` instance for method chaining.
+ *
+ * Example:
+ * ```
+ * provisioner.setShutdownGracePeriod(2000);
+ * ```
+ */
+WiFiProvisioner &
+WiFiProvisioner::setShutdownGracePeriod(unsigned long gracePeriod) {
+  _shutdownGracePeriod = gracePeriod;
+  return *this;
+}
+
+/**
+ * @brief Sets how long `reconnect()` and `connect()` try to join the stored
+ * network before giving up. Half of the budget goes to joining the stored
+ * access point directly. Defaults to 10 seconds.
+ *
+ * @param budget The budget in milliseconds, `0` to go straight to the portal.
+ *
+ * @return A reference to the `WiFiProvisioner` instance for method chaining.
+ *
+ * Example:
+ * ```
+ * provisioner.setReconnectBudget(4000);
+ * ```
+ */
+WiFiProvisioner &WiFiProvisioner::setReconnectBudget(unsigned long budget) {
+  _reconnectBudget = budget;
+  return *this;
+}
+
+/**
+ * @brief Sets how long a connection attempt from the portal may take before
+ * it fails, and how long the station settles after disconnecting before it
+ * joins the network. Default to 10 seconds and 100 milliseconds.
+ *
+ * The settle delay is also waited for before the access point is started.
+ *
+ * @param timeout The connection timeout in milliseconds.
+ * @param settleDelay The settle delay in milliseconds.
+ *
+ * @return A reference to the `WiFiProvisioner` instance for method chaining.
+ *
+ * Example:
+ * ```
+ * provisioner.setConnectionTimeout(15000); // Slow DHCP server
+ * ```
+ */
+WiFiProvisioner &
+WiFiProvisioner::setConnectionTimeout(unsigned long timeout,
+                                      unsigned long settleDelay) {
+  _wifiConnectionTimeout = timeout;
+  _wifiDelay = settleDelay;
+  _connector->setTimeout(timeout);
+  _connector->setSettleDelay(settleDelay);
+  return *this;
+}
+
+/**
+ * @brief Configures persistent HTTP connections.
+ *
+ * Clients that ask for it, which HTTP/1.1 clients do by default, keep their
+ * connection open between requests, so the page load, the `/update` polls and
+ * the connection status checks do not each pay for a new TCP handshake. An
+ * idle connection is closed after `idleTimeout`, and when `maxConnections`
+ * are open the one idle the longest is closed to make room. An idle timeout of
+ * zero closes every connection after its response. Defaults to 5 seconds and
+ * 4 connections.
+ *
+ * Persistent connections need support from the platform's HTTP server. The
+ * ESP32 `WebServer`, used when the library is built with
+ * `WIFI_PROVISIONER_SOCKET_SERVER` set to `0`, does not keep connections
+ * open, so there every response is still sent with `Connection: close`.
+ *
+ * @param idleTimeout How long an idle connection is kept open in
+ * milliseconds.
+ * @param maxConnections How many connections may be open at once.
+ *
+ * @return A reference to the `WiFiProvisioner` instance for method chaining.
+ *
+ * Example:
+ * ```
+ * provisioner.setKeepAlive(10000, 6);
+ * ```
+ */
+WiFiProvisioner &WiFiProvisioner::setKeepAlive(unsigned long idleTimeout,
+                                               size_t maxConnections) {
+  _keepAliveTimeout = idleTimeout;
+  _keepAliveConnections = maxConnections;
+  return *this;
+}
+
+/**
+ * @brief Sets how quickly the provisioning loop backs off when idle.
+ *
+ * While clients are talking to the portal, the loop only yields between
+ * iterations. After `shortSleepAfter` milliseconds without traffic it sleeps
+ * 1 ms per iteration, and after `longSleepAfter` milliseconds it sleeps
+ * `longSleep` milliseconds per iteration, which lets the CPU idle and saves
+ * power. New traffic, HTTP or DNS, returns the loop to full speed at once,
+ * so a burst of DNS lookups is answered without a sleep between queries.
+ * Defaults to 50 ms, 1000 ms and 20 ms.
+ *
+ * @param shortSleepAfter Idle time before the loop starts sleeping 1 ms per
+ * iteration.
+ * @param longSleepAfter Idle time before the loop starts sleeping `longSleep`
+ * per iteration.
+ * @param longSleep The longest sleep per iteration, which bounds the added
+ * latency of the first request after an idle period.
+ *
+ * @return A reference to the `WiFiProvisioner` instance for method chaining.
+ *
+ * Example:
+ * ```
+ * provisioner.setIdleBackoff(100, 5000, 50);
+ * ```
+ */
+WiFiProvisioner &WiFiProvisioner::setIdleBackoff(unsigned long shortSleepAfter,
+                                                 unsigned long longSleepAfter,
+                                                 unsigned long longSleep) {
+  _idlePump->configure(shortSleepAfter, longSleepAfter, longSleep);
+  return *this;
+}
+
+/**
+ * @brief Returns how busy the provisioning loop has been.
+ *
+ * The statistics cover the current or most recent provisioning session.
+ * `dutyCycle` is the fraction of time spent serving DNS and HTTP requests
+ * rather than yielding or sleeping.
+ *
+ * @return A `PumpStats` structure with the busy and idle time in
+ * microseconds, the number of loop iterations and sleeps, and the duty cycle.
+ *
+ * Example:
+ * ```
+ * WiFiProvisioner::PumpStats stats = provisioner.getPumpStats();
+ * Serial.printf("Duty cycle: %.1f%%\n", stats.dutyCycle * 100);
+ * ```
+ */
+WiFiProvisioner::PumpStats WiFiProvisioner::getPumpStats() const {
+  return _idlePump->stats();
+}
+
+/**
+ * @brief Returns the connection and I/O counters of the portal's HTTP server.
+ *
+ * The counters are a snapshot the provisioning loop takes after serving
+ * clients, and keep their last values once provisioning has ended. They
+ * include the number of connections open at once, which shows how many
+ * clients the server handles concurrently. Servers that do not keep counters,
+ * such as the ESP32 `WebServer` backend, report zeros.
+ *
+ * @return The server statistics.
+ *
+ * Example:
+ * ```
+ * WiFiProvisioner::ServerStats stats = provisioner.getServerStats();
+ * Serial.printf("%u requests, at most %u connections at once\n",
+ *               stats.requests, stats.peakConnections);
+ * ```
+ */
+WiFiProvisioner::ServerStats WiFiProvisioner::getServerStats() const {
+  std::lock_guard<PumpTask> guard(*_pumpTask);
+  return _serverStats;
+}
+
+/**
+ * @brief Returns how the portal's responses were handed to the HTTP server.
+ *
+ * Each response is collected in a buffer of
+ * `WIFI_PROVISIONER_RESPONSE_BUFFER_SIZE` bytes, the TCP MSS by default, and
+ * sent whenever the buffer fills up. `segments` counts the buffer-sized
+ * pieces the responses were sent in, which matches the TCP segments on the
+ * wire as long as the socket takes every write at once. `errors` counts the
+ * responses with a 4xx or 5xx status. The counters are reset when
+ * provisioning starts and work with every server backend.
+ *
+ * @return The response statistics.
+ *
+ * Example:
+ * ```
+ * WiFiProvisioner::ResponseStats stats = provisioner.getResponseStats();
+ * Serial.printf("%.1f segments per response\n",
+ *               stats.segments / (float)stats.responses);
+ * ```
+ */
+WiFiProvisioner::ResponseStats WiFiProvisioner::getResponseStats() const {
+  std::lock_guard<PumpTask> guard(*_pumpTask);
+  return _responseSnapshot;
+}
+
+/**
+ * @brief Returns the connectivity checks the portal answered per operating
+ * system, and how many requests were served the provisioning page.
+ *
+ * Probes are answered with a redirect and not counted as pages. The counters
+ * are reset when provisioning starts.
+ *
+ * @return The probe statistics.
+ *
+ * Example:
+ * ```
+ * WiFiProvisioner::ProbeStats stats = provisioner.getProbeStats();
+ * Serial.printf("%u Android probes, %u pages\n", stats.android, stats.pages);
+ * ```
+ */
+WiFiProvisioner::ProbeStats WiFiProvisioner::getProbeStats() const {
+  std::lock_guard<PumpTask> guard(*_pumpTask);
+  return _probeSnapshot;
+}
+
+/**
+ * @brief Returns the `/events` streams and the events sent to them.
+ *
+ * Every event counts once per stream it was sent to. The snapshot a stream
+ * starts with is part of the `/events` response and counted with the
+ * responses instead. A stream that fell too far behind is closed and counted
+ * in the server's `overflows`. The counters are reset when
+ * provisioning starts.
+ *
+ * @return The event statistics.
+ *
+ * Example:
+ * ```
+ * WiFiProvisioner::EventStats stats = provisioner.getEventStats();
+ * Serial.printf("%u streams open, %u events sent\n", stats.streams,
+ *               stats.events);
+ * ```
+ */
+WiFiProvisioner::EventStats WiFiProvisioner::getEventStats() const {
+  std::lock_guard<PumpTask> guard(*_pumpTask);
+  return _eventSnapshot;
+}
+
+/**
+ * @brief Returns the outcome of the last `reconnect()`.
+ *
+ * `timeToConnected` is the time from starting to join until the station was
+ * connected, or until the budget ran out. `fastPath` tells whether the
+ * stored access point was joined directly.
+ *
+ * @return The reconnect statistics.
+ *
+ * Example:
+ * ```
+ * WiFiProvisioner::ReconnectStats stats = provisioner.getReconnectStats();
+ * Serial.printf("Connected after %lu ms\n", stats.timeToConnected);
+ * ```
+ */
+WiFiProvisioner::ReconnectStats WiFiProvisioner::getReconnectStats() const {
+  return _reconnectStats;
+}
+
+/**
+ * @brief Returns the memory headroom the portal left while it ran.
+ *
+ * The free heap and the largest free block are sampled when provisioning
+ * starts, before the portal allocates anything, on entry to and exit from
+ * every request handler, and after the portal has shut down. The minimums
+ * show the worst case while serving, and the difference between the start
+ * and shutdown values shows whether anything leaked. The stack high-water
+ * mark is the least stack the serving task had left, which is the
+ * provisioning task when running in the background. Values the platform
+ * cannot measure are 0.
+ *
+ * @return A copy of the memory statistics.
+ *
+ * Example:
+ * ```
+ * WiFiProvisioner::MemoryStats stats = provisioner.getMemoryStats();
+ * Serial.printf("Heap headroom %u bytes, %u bytes of stack unused\n",
+ *               stats.minFreeHeap, stats.stackHighWaterMark);
+ * ```
+ */
+WiFiProvisioner::MemoryStats WiFiProvisioner::getMemoryStats() const {
+  std::lock_guard<PumpTask> guard(*_pumpTask);
+  return _memoryStats;
+}
+
+/**
+ * @brief Returns the request counters and handler latency histogram of every
+ * route.
+ *
+ * Each registered path has its own entry, and requests for unknown paths,
+ * such as most captive-portal probes, are counted under `*`. The latency is
+ * the time the handler took to build and send its response, sorted into the
+ * buckets bounded by `RouteStats::LATENCY_BOUNDS`. The counters are reset
+ * when provisioning starts. They are updated without locks, so this method
+ * may be called from any task while the portal is running.
+ *
+ * @param stats The array receiving the statistics.
+ * @param capacity The number of entries in `stats`.
+ *
+ * @return The number of routes, which may exceed `capacity`.
+ *
+ * Example:
+ * ```
+ * WiFiProvisioner::RouteStats routes[12];
+ * size_t count = provisioner.getRouteStats(routes, 12);
+ * for (size_t i = 0; i < count && i < 12; ++i) {
+ *   Serial.printf("%s: %u requests, %u errors\n", routes[i].route,
+ *                 routes[i].requests, routes[i].errors);
+ * }
+ * ```
+ */
+size_t WiFiProvisioner::getRouteStats(RouteStats *stats,
+                                      size_t capacity) const {
+  return _routeMetrics->snapshot(stats, capacity);
+}
+
+/**
+ * @brief Enables the `/stats` endpoint, which reports the memory, server,
+ * response and loop statistics as JSON.
+ *
+ * The endpoint is meant for development and is disabled by default. The
+ * setting takes effect the next time provisioning starts.
+ *
+ * @param enabled Whether to serve `/stats`.
+ *
+ * @return A reference to the `WiFiProvisioner` instance for method chaining.
+ *
+ * Example:
+ * ```
+ * provisioner.setStatsEndpoint(true); // curl http://192.168.4.1/stats
+ * ```
+ */
+WiFiProvisioner &WiFiProvisioner::setStatsEndpoint(bool enabled) {
+  _statsEndpoint = enabled;
+  return *this;
+}
+
+/**
+ * @brief Handles the HTTP `/` request.
+ *
+ * This function responds to the root URL (`/`) by sending the provisioning
+ * page. The page is served with a single write from the page cache, which is
+ * rendered from the predefined fragments and the Wi-Fi provisioning
+ * configuration only when the configuration has changed. Clients that send
+ * `Accept-Encoding: gzip` get the gzip encoded page. If the cache buffer
+ * cannot be allocated, the fragments are streamed as a chunked body instead.
+ *
+ * The page is sent with an `ETag` and `Cache-Control: no-cache`. A request
+ * whose `If-None-Match` matches the current tag is answered with
+ * `304 Not Modified` and no body; it does not invoke the page view callback
+ * and is not counted in the probe statistics.
+ *
+ */
 void WiFiProvisioner::handleRootRequest() {
-  if (provisionCallback) {
-    provisionCallback();
+  ResponseWriter response(*_server, _responseStats);
+  bool gzip = acceptsGzip(_server->header("Accept-Encoding"));
+  const char *etag = _pageCache->etag(_config, gzip);
+  if (matchesEtag(_server->header("If-None-Match"), etag)) {
+    sendHeader(response, 304, nullptr, 0, nullptr, etag);
+    response.end();
+    return;
   }
 
-  const char *showResetField = _config.SHOW_RESET_FIELD ? "true" : "false";
+  if (pageViewCallback) {
+    pageViewCallback();
+  }
+  _probeStats.pages++;
 
-  char inputLengthStr[12];
-  snprintf(inputLengthStr, sizeof(inputLengthStr), "%d", _config.INPUT_LENGTH);
+  // Slow clients may still be sent the page about to be rendered again
+  if (_pageCache->isDirty()) {
+    _server->detachBorrowed();
+  }
 
-  size_t contentLength =
-      strlen_P(index_html1) + strlen(_config.HTML_TITLE) +
-      strlen_P(index_html2) + strlen(_config.THEME_COLOR) +
-      strlen_P(index_html3) + strlen(_config.SVG_LOGO) + strlen_P(index_html4) +
-      strlen(_config.PROJECT_TITLE) + strlen_P(index_html5) +
-      strlen(_config.PROJECT_SUB_TITLE) + strlen_P(index_html6) +
-      strlen(_config.PROJECT_INFO) + strlen_P(index_html7) +
-      strlen(_config.INPUT_TEXT) + strlen_P(index_html8) +
-      strlen(inputLengthStr) + strlen_P(index_html9) +
-      strlen(_config.CONNECTION_SUCCESSFUL) + strlen_P(index_html10) +
-      strlen(_config.FOOTER_TEXT) + strlen_P(index_html11) +
-      strlen(_config.RESET_CONFIRMATION_TEXT) + strlen_P(index_html12) +
-      strlen(showResetField) + strlen_P(index_html13);
+  size_t contentLength = 0;
+  const char *page = _pageCache->acquire(_config, contentLength, gzip);
+  if (page != nullptr) {
+    etag = _pageCache->etag(_config, gzip);
+    sendHeader(response, 200, "text/html", contentLength,
+               gzip ? "gzip" : nullptr, etag);
+    response.writeBorrowed(reinterpret_cast<const uint8_t *>(page),
+                           contentLength);
+  } else {
+    char inputLength[12];
+    PageCache::Fragment parts[PageCache::FRAGMENT_COUNT];
+    contentLength = PageCache::fragments(_config, inputLength, parts);
+    etag = _pageCache->etag(_config);
+
+    sendHeader(response, 200, "text/html", STREAMED_LENGTH, nullptr, etag);
+    for (size_t i = 0; i < PageCache::FRAGMENT_COUNT; ++i) {
+      response.write(reinterpret_cast<const uint8_t *>(parts[i].data),
+                     parts[i].length);
+    }
+  }
 
-  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
-                             "Calculated Content Length: %zu", contentLength);
-
-  WiFiClient client = _server->client();
-  sendHeader(client, 200, "text/html", contentLength);
-
-  client.write_P(index_html1, strlen_P(index_html1));
-  client.print(_config.HTML_TITLE);
-  client.write_P(index_html2, strlen_P(index_html2));
-  client.print(_config.THEME_COLOR);
-  client.write_P(index_html3, strlen_P(index_html3));
-  client.print(_config.SVG_LOGO);
-  client.write_P(index_html4, strlen_P(index_html4));
-  client.print(_config.PROJECT_TITLE);
-  client.write_P(index_html5, strlen_P(index_html5));
-  client.print(_config.PROJECT_SUB_TITLE);
-  client.write_P(index_html6, strlen_P(index_html6));
-  client.print(_config.PROJECT_INFO);
-  client.write_P(index_html7, strlen_P(index_html7));
-  client.print(_config.INPUT_TEXT);
-  client.write_P(index_html8, strlen_P(index_html8));
-  client.print(inputLengthStr);
-  client.write_P(index_html9, strlen_P(index_html9));
-  client.print(_config.CONNECTION_SUCCESSFUL);
-  client.write_P(index_html10, strlen_P(index_html10));
-  client.print(_config.FOOTER_TEXT);
-  client.write_P(index_html11, strlen_P(index_html11));
-  client.print(_config.RESET_CONFIRMATION_TEXT);
-  client.write_P(index_html12, strlen_P(index_html12));
-  client.print(showResetField);
-  client.write_P(index_html13, strlen_P(index_html13));
-  client.flush();
-  client.stop();
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG,
+                             "Sent provisioning page: %zu bytes",
+                             contentLength);
+
+  response.end();
+}
+
+/**
+ * @brief Handles the connectivity-check URLs and unknown paths.
+ *
+ * Operating systems probe a well-known URL after joining a network, and
+ * repeat the probe in the background while the portal is open. A probe is
+ * answered with a `302 Found` to the provisioning page and no body, which
+ * any answer other than the expected one would do to make the OS show its
+ * captive-portal UI, without running the provision callback or sending the
+ * page. Other requests, such as a browser navigating to some URL, get the
+ * page as from `/`.
+ */
+void WiFiProvisioner::handleProbeRequest() {
+  ProbeClassifier::Os os = ProbeClassifier::classify(*_server);
+  if (os == ProbeClassifier::NONE) {
+    handleRootRequest();
+    return;
+  }
+  ProbeClassifier::count(os, _probeStats);
+
+  ResponseWriter response(*_server, _responseStats);
+  sendRedirect(response, _apIP);
+  response.end();
 }
 
 /**
@@ -638,12 +1771,29 @@ void WiFiProvisioner::handleRootRequest() {
  * a JSON response that includes a list of available Wi-Fi networks with
  * details such as SSID, signal strength (RSSI), and authentication mode. It
  * also includes a flag `show_code` indicating whether the input field for
- * additional credentials is enabled.
+ * additional credentials is enabled, and a flag `scanning` indicating whether
+ * a background scan is in progress.
+ *
+ * The network list is served from the scan cache and never waits for a scan.
+ * If the cached results are stale, a background rescan is started and its
+ * results are returned by a later request.
+ *
+ * The response is streamed from the scan results as a chunked body, so it
+ * needs no heap and is generated only once.
+ *
+ * Each response carries the `version` of the scan results. A client that
+ * passes the version it has as `?since=<version>` gets a delta instead, which
+ * echoes `since` and lists only the networks that were added or changed
+ * after it, plus the SSIDs that were `removed` after it. If the changes since
+ * that version are no longer known, the full list is sent without `since`
+ * and the client has to replace its list.
  *
  * Example JSON Response:
  * ```
  * {
  *   "show_code": "false",
+ *   "scanning": false,
+ *   "version": 7,
  *   "network": [
  *     { "ssid": "Network1", "rssi": 4, "authmode": 1 },
  *     { "ssid": "Network2", "rssi": 2, "authmode": 0 },
@@ -652,44 +1802,74 @@ void WiFiProvisioner::handleRootRequest() {
  * }
  * ```
  *
+ * Example delta for `/update?since=7`:
+ * ```
+ * {
+ *   "show_code": "false",
+ *   "scanning": false,
+ *   "version": 8,
+ *   "since": 7,
+ *   "network": [
+ *     { "ssid": "Network4", "rssi": 1, "authmode": 1 }
+ *   ],
+ *   "removed": ["Network2"]
+ * }
+ * ```
+ *
  * @note
  * - The `authmode` field indicates the security mode of the network:
  *   - `0`: Open (no password required)
  *   - `1`: Secured (password required)
  */
 void WiFiProvisioner::handleUpdateRequest() {
-  JsonDocument doc;
-
-  doc["show_code"] = _config.SHOW_INPUT_FIELD;
-  networkScan(doc);
+  _scanEngine->poll();
+  if (!_connector->isActive()) {
+    _scanEngine->refresh();
+  }
 
-  WiFiClient client = _server->client();
-  sendHeader(client, 200, "application/json", measureJson(doc));
-  serializeJson(doc, client);
+  uint32_t since = 0;
+  bool delta = false;
+  if (_server->hasArg("since")) {
+    const char *arg = _server->arg("since");
+    char *end;
+    unsigned long value = strtoul(arg, &end, 10);
+    if (end != arg && *end == '\0') {
+      since = static_cast<uint32_t>(value);
+      delta = _scanEngine->knowsChangesSince(since);
+    }
+  }
 
-  client.flush();
-  client.stop();
+  ResponseWriter response(*_server, _responseStats);
+  sendHeader(response, 200, "application/json", STREAMED_LENGTH);
+  JsonStream json(response);
+  writeUpdate(json, _config.SHOW_INPUT_FIELD, *_scanEngine, delta, since);
+  response.end();
 }
 
 /**
  * @brief Handles the `/configure` HTTP request.
  *
  * This function expects a JSON payload containing Wi-Fi credentials and an
- * optional input field. It attempts to connect to the specified network and
- * validates the optional input field if provided.
+ * optional input field. It starts a connection attempt and responds at once
+ * with the id of the attempt, whose progress is then reported by `/status`.
  *
  * 1. Parses the incoming JSON payload for:
- *    - `ssid` (required): The Wi-Fi network name.
- *    - `password` (optional): The Wi-Fi password.
- *    - `code` (optional): Additional input for custom validation.
+ *    - `ssid` (required): The Wi-Fi network name, at most 32 bytes.
+ *    - `password` (optional): The Wi-Fi password, at most 64 bytes.
+ *    - `code` (optional): Additional input for custom validation, at most
+ *      `INPUT_LENGTH` bytes.
  *
- * 2. Attempts to connect to the network.
+ * 2. Starts a connection attempt that the provisioning loop advances, so the
+ * portal keeps serving requests while the device connects.
  *
- * 3. If the `inputCheckCallback` is set, invokes it and returns an
- * unsuccessful response if the validation fails.
+ * 3. Responds with `202 Accepted` and the job id, or `409 Conflict` if a
+ * connection attempt is already in progress.
  *
- * 4. If the connection and input check is successful, invokes the
- * `onSuccessCallback` with the `ssid`, `password` and `input`.
+ * The credentials are extracted into fixed buffers without building a JSON
+ * document, and the response is streamed, so the request allocates no heap
+ * beyond the server's copy of the body. Bodies larger than
+ * `WIFI_PROVISIONER_MAX_BODY_SIZE` are answered with `413 Payload Too Large`,
+ * by servers that support a body size limit before the body is read.
  *
  * Example JSON Payload:
  * ```
@@ -699,165 +1879,522 @@ void WiFiProvisioner::handleUpdateRequest() {
  *   "code": "1234"
  * }
  * ```
+ *
+ * Example JSON Response:
+ * ```
+ * { "job": 1 }
+ * ```
  */
 void WiFiProvisioner::handleConfigureRequest() {
-  if (!_server->hasArg("plain")) {
+  ResponseWriter response(*_server, _responseStats);
+  const char *body = _server->arg("plain");
+  size_t bodyLength = strlen(body);
+  if (bodyLength == 0) {
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
                                "No 'plain' argument found in request");
-    sendBadRequestResponse();
+    sendBadRequestResponse(response);
+    return;
+  }
+  if (bodyLength > WIFI_PROVISIONER_MAX_BODY_SIZE) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
+                               "Request body too large: %zu bytes",
+                               bodyLength);
+    sendHeader(response, 413, "text/html", 0);
+    response.end();
     return;
   }
 
-  JsonDocument doc;
-  auto error = deserializeJson(doc, _server->arg("plain"));
-  if (error) {
+  CredentialsParser request;
+  size_t maxInputLength = _config.INPUT_LENGTH > 0 ? _config.INPUT_LENGTH : 0;
+  CredentialsParser::Result result =
+      request.parse(body, bodyLength, maxInputLength);
+  if (result != CredentialsParser::OK) {
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
-                               "JSON parsing failed: %s", error.c_str());
-    sendBadRequestResponse();
+                               "JSON parsing failed: %s",
+                               result == CredentialsParser::TOO_LONG
+                                   ? "credentials too long"
+                                   : "malformed");
+    sendBadRequestResponse(response);
     return;
   }
 
-  const char *ssid_connect = doc["ssid"];
-  const char *pass_connect = doc["password"];
-  const char *input_connect = doc["code"];
+  const char *ssid_connect = request.ssid();
+  const char *pass_connect = request.password();
+  const char *input_connect = request.input();
 
-  WIFI_PROVISIONER_DEBUG_LOG(
-      WIFI_PROVISIONER_LOG_INFO, "SSID: %s, PASSWORD: %s, INPUT: %s",
-      ssid_connect ? ssid_connect : "", pass_connect ? pass_connect : "",
-      input_connect ? input_connect : "");
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_DEBUG,
+                             "Credentials received, password: %s, input: %s",
+                             pass_connect ? "yes" : "no",
+                             input_connect ? "yes" : "no");
 
   if (!ssid_connect) {
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
                                "SSID missing from request");
-    sendBadRequestResponse();
+    sendBadRequestResponse(response);
     return;
   }
 
-  WiFi.disconnect(false, true);
-  delay(_wifiDelay);
-
-  if (!connect(ssid_connect, pass_connect)) {
+  if (_connector->isActive() || _shutdownPending) {
     WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
-                               "Failed to connect to WiFi: %s with password %s",
-                               ssid_connect, pass_connect ? pass_connect : "");
-    handleUnsuccessfulConnection("ssid");
+                               "Connection attempt already in progress");
+    sendHeader(response, 409, "application/json", STREAMED_LENGTH);
+    JsonStream json(response);
+    json.beginObject();
+    json.key("success").value(false);
+    json.key("reason").value("busy");
+    json.endObject();
+    response.end();
     return;
   }
 
-  if (input_connect && inputCheckCallback &&
-      !inputCheckCallback(input_connect)) {
-    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
-                               "Input check callback failed.");
-    handleUnsuccessfulConnection("code");
+  uint32_t job = _connector->begin(ssid_connect, pass_connect, input_connect);
+  if (job == 0) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
+                               "Invalid credentials in request");
+    sendBadRequestResponse(response);
     return;
   }
 
-  handleSuccesfulConnection();
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
+                             "Attempting to connect to SSID: %s (job %u)",
+                             ssid_connect, static_cast<unsigned>(job));
+
+  sendHeader(response, 202, "application/json", STREAMED_LENGTH);
+  JsonStream json(response);
+  json.beginObject();
+  json.key("job").value(static_cast<unsigned long>(job));
+  json.endObject();
+  response.end();
+}
 
-  if (onSuccessCallback) {
-    onSuccessCallback(ssid_connect, pass_connect, input_connect);
+/**
+ * @brief Handles the `/status` HTTP request.
+ *
+ * Reports the progress of the connection attempt started by `/configure`. The
+ * `job` query parameter selects the attempt; a request for any other job gets
+ * `404 Not Found`.
+ *
+ * The `state` field is one of `idle`, `associating`, `got_ip`, `verified` or
+ * `failed`. Once the attempt has finished, `success` tells the outcome and
+ * `reason` tells why it failed ("ssid" or "code").
+ *
+ * Example JSON Response:
+ * ```
+ * { "job": 1, "state": "failed", "success": false, "reason": "ssid" }
+ * ```
+ */
+void WiFiProvisioner::handleStatusRequest() {
+  ResponseWriter response(*_server, _responseStats);
+
+  uint32_t job = strtoul(_server->arg("job"), nullptr, 10);
+  bool known = job != 0 && job == _connector->id();
+  sendHeader(response, known ? 200 : 404, "application/json",
+             STREAMED_LENGTH);
+  JsonStream json(response);
+  if (known) {
+    writeStatus(json, *_connector);
+  } else {
+    json.beginObject();
+    json.key("job").value(static_cast<unsigned long>(job));
+    json.key("state").value("unknown");
+    json.endObject();
   }
+  response.end();
+}
 
-  // Show success page for a while before closing the server
-  delay(7000);
+/**
+ * @brief Handles the `/events` HTTP request.
+ *
+ * Opens a stream of server-sent events, so that the page learns about new
+ * scan results and the progress of a connection attempt over one connection
+ * instead of polling `/update` and `/status`. The stream starts with a
+ * snapshot: a `scan` event with the full network list, and a `status` event
+ * if a connection attempt has been started. After that, the loop sends
+ *
+ * - a `scan` event with the `/update` delta whenever a scan changes the list,
+ *   including the signal level of a network, and
+ *
+ * - a `status` event with the `/status` response whenever the connection
+ *   attempt changes state.
+ *
+ * Each stream may fall behind by `WIFI_PROVISIONER_EVENT_QUEUE_SIZE` bytes
+ * before it is closed, and at most `WIFI_PROVISIONER_MAX_EVENT_STREAMS` are
+ * kept open. Streams need an HTTP server that supports them, which the socket
+ * server does. With the ESP32 core's `WebServer`, which serves one client at a
+ * time, the request is answered with `503 Service Unavailable` and the page
+ * keeps polling.
+ *
+ * Example stream:
+ * ```
+ * retry: 2000
+ *
+ * event: scan
+ * data: {"show_code":false,"scanning":false,"version":3,"network":[...]}
+ *
+ * event: status
+ * data: {"job":1,"state":"associating"}
+ * ```
+ */
+void WiFiProvisioner::handleEventsRequest() {
+  ResponseWriter response(*_server, _responseStats);
+  uint32_t stream = _server->beginStream(WIFI_PROVISIONER_EVENT_QUEUE_SIZE);
+  if (stream == HttpServer::NO_STREAM) {
+    sendHeader(response, 503, "text/html", 0);
+    response.end();
+    return;
+  }
 
-  // Signal to break from loop
-  _serverLoopFlag = true;
+  sendHeader(response, 200, "text/event-stream", STREAMED_LENGTH);
+  // How long the page waits before reconnecting a dropped stream
+  static const char retry[] = "retry: 2000\n\n";
+  response.write(reinterpret_cast<const uint8_t *>(retry), sizeof(retry) - 1);
+  EventHub::write(response, "scan", [this](ResponseWriter &output) {
+    JsonStream json(output);
+    writeUpdate(json, _config.SHOW_INPUT_FIELD, *_scanEngine, false, 0);
+  });
+  if (_connector->id() != 0) {
+    EventHub::write(response, "status", [this](ResponseWriter &output) {
+      JsonStream json(output);
+      writeStatus(json, *_connector);
+    });
+  }
+  response.end();
+
+  _eventHub->add(*_server, stream);
 }
 
 /**
- * @brief Attempts to connect to the specified Wi-Fi network.
+ * @brief Copies the statistics the loop keeps for the getters.
  *
- * @param ssid The SSID of the Wi-Fi network.
- * @param password The password for the Wi-Fi network. Pass `nullptr` or an
- * empty string for open networks.
- * @return `true` if the connection is successful; `false` otherwise.
+ * The handlers update their counters without locks, as they run on the loop
+ * task only. The getters may be called from any task, so they read copies
+ * that are taken here once per iteration under the pump task's lock.
  */
-bool WiFiProvisioner::connect(const char *ssid, const char *password) {
-  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
-                             "Attempting to connect to SSID: %s", ssid);
+void WiFiProvisioner::publishStats() {
+  ServerStats server = _server ? _server->stats() : ServerStats();
+  EventStats events = _eventHub->stats();
+  PageCacheStats pageCache = _pageCache->stats();
+
+  std::lock_guard<PumpTask> guard(*_pumpTask);
+  if (_server) {
+    _serverStats = server;
+  }
+  _responseSnapshot = _responseStats;
+  _probeSnapshot = _probeStats;
+  _eventSnapshot = events;
+  _pageCacheSnapshot = pageCache;
+}
 
-  if (!ssid || strlen(ssid) == 0) {
-    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR,
-                               "Invalid SSID provided");
-    return false;
+/**
+ * @brief Sends what changed since the last loop iteration to the `/events`
+ * streams.
+ *
+ * A new scan version is sent as the `/update` delta since the version sent
+ * before, or as the full list if that delta is no longer known. While streams
+ * are open, stale scan results are refreshed here, as the page no longer
+ * polls `/update` to do so.
+ */
+void WiFiProvisioner::publishEvents() {
+  if (_server == nullptr) {
+    return;
+  }
+  if (_eventHub->count() > 0 && !_connector->isActive()) {
+    _scanEngine->refresh();
   }
 
-  if (password && strlen(password) > 0) {
-    WiFi.begin(ssid, password);
-  } else {
-    WiFi.begin(ssid);
+  uint32_t version = _scanEngine->version();
+  if (version != _publishedScanVersion) {
+    uint32_t since = _publishedScanVersion;
+    bool delta = _scanEngine->knowsChangesSince(since);
+    _eventHub->publish(*_server, "scan", [&](ResponseWriter &output) {
+      JsonStream json(output);
+      writeUpdate(json, _config.SHOW_INPUT_FIELD, *_scanEngine, delta, since);
+    });
+    _publishedScanVersion = version;
   }
 
-  unsigned long startTime = millis();
-  while (WiFi.status() != WL_CONNECTED) {
-    delay(_wifiDelay);
+  if (_connector->id() != _publishedJob ||
+      _connector->state() != _publishedState) {
+    _eventHub->publish(*_server, "status", [this](ResponseWriter &output) {
+      JsonStream json(output);
+      writeStatus(json, *_connector);
+    });
+    _publishedJob = _connector->id();
+    _publishedState = _connector->state();
+  }
 
-    if (millis() - startTime >= _wifiConnectionTimeout) {
-      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR,
-                                 "WiFi connection timeout reached for SSID: %s",
-                                 ssid);
-      return false;
+  _eventHub->heartbeat(*_server);
+}
+
+/**
+ * @brief Advances the pending connection attempt and finishes provisioning.
+ *
+ * Once the station has an IP address, the optional input is validated with
+ * the `inputCheckCallback`. On success the `onSuccessCallback` is invoked and
+ * the server is shut down once the shutdown grace period has passed, or
+ * earlier if the page confirms through `/complete` that it has shown the
+ * success page.
+ */
+void WiFiProvisioner::advanceConnection() {
+  Connector::State before = _connector->state();
+  _connector->advance(!_scanEngine->isScanning());
+
+  if (_connector->state() == Connector::GOT_IP) {
+    const char *input = _connector->input();
+    bool valid = !(input && inputCheckCallback && !inputCheckCallback(input));
+    if (!valid) {
+      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
+                                 "Input check callback failed.");
+    }
+    _connector->verify(valid);
+
+    if (valid) {
+      WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
+                                 "Successfully connected to SSID: %s",
+                                 _connector->ssid());
+      storeCredentials(_connector->ssid(), _connector->password());
+      if (onSuccessCallback) {
+        onSuccessCallback(_connector->ssid(), _connector->password(),
+                          input);
+      }
+      _provisioned = true;
+      _successAt = millis();
+      _shutdownPending = true;
     }
+  } else if (before == Connector::ASSOCIATING &&
+             _connector->state() == Connector::FAILED) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_ERROR,
+                               "WiFi connection timeout reached for SSID: %s",
+                               _connector->ssid());
   }
 
-  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
-                             "Successfully connected to SSID: %s", ssid);
-  return true;
+  // Keep serving the success page until the grace period has passed
+  if (_shutdownPending && millis() - _successAt >= _shutdownGracePeriod) {
+    // Signal to break from loop
+    _serverLoopFlag = true;
+  }
 }
 
 /**
- * @brief Sends a generic HTTP 400 Bad Request response.
+ * @brief Handles the `/complete` HTTP request.
+ *
+ * The provisioning page posts to this endpoint once it has shown the success
+ * page. After a successful connection this ends the provisioning loop without
+ * waiting for the rest of the shutdown grace period.
  */
-void WiFiProvisioner::sendBadRequestResponse() {
-  WiFiClient client = _server->client();
+void WiFiProvisioner::handleCompleteRequest() {
+  ResponseWriter response(*_server, _responseStats);
+  if (!_shutdownPending) {
+    sendHeader(response, 409, "text/html", 0);
+    response.end();
+    return;
+  }
+
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
+                             "Success page shown, closing server");
 
-  sendHeader(client, 400, "text/html", 0);
+  sendHeader(response, 200, "text/html", 0);
+  response.end();
 
-  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
-                             "Sent 400 Bad Request response to client");
+  // Signal to break from loop
+  _serverLoopFlag = true;
+}
 
-  client.flush();
-  client.stop();
+/**
+ * @brief Handles the `/stats` HTTP request.
+ *
+ * Streams the statistics that `getMemoryStats()`, `getServerStats()`,
+ * `getResponseStats()`, `getEventStats()`, `getPumpStats()` and
+ * `getRouteStats()` return. Each route's `latency` lists the requests per
+ * bucket, bounded by `latency_bounds_us` with a last bucket for slower
+ * requests. The memory statistics and route counters include the sample
+ * taken on entry to this request, but not the request itself.
+ *
+ * Example JSON Response:
+ * ```
+ * {
+ *   "memory": { "start_free_heap": 231000, "min_free_heap": 187000, ... },
+ *   "server": { "connections": 1, "requests": 42, ... },
+ *   "responses": { "responses": 42, "segments": 97, "bytes": 120000 },
+ *   "pump": { "busy_us": 51000, "idle_us": 9200000, ... },
+ *   "latency_bounds_us": [1000, 2500, 5000, ...],
+ *   "routes": [
+ *     { "route": "/", "requests": 3, "errors": 0, "bytes": 36000,
+ *       "latency": [0, 0, 2, 1, 0, 0, 0, 0, 0] },
+ *     ...
+ *   ]
+ * }
+ * ```
+ */
+void WiFiProvisioner::handleStatsRequest() {
+  MemoryStats memory = _memoryStats;
+  ServerStats server = _serverStats;
+  ResponseStats responses = _responseStats;
+  PumpStats pump = _idlePump->stats();
+  ProbeStats probes = _probeStats;
+  EventStats events = _eventHub->stats();
+
+  ResponseWriter response(*_server, _responseStats);
+  sendHeader(response, 200, "application/json", STREAMED_LENGTH);
+  JsonStream json(response);
+  json.beginObject();
+
+  json.key("memory").beginObject();
+  json.key("start_free_heap").value(memory.startFreeHeap);
+  json.key("start_largest_free_block").value(memory.startLargestFreeBlock);
+  json.key("min_free_heap").value(memory.minFreeHeap);
+  json.key("min_largest_free_block").value(memory.minLargestFreeBlock);
+  json.key("shutdown_free_heap").value(memory.shutdownFreeHeap);
+  json.key("shutdown_largest_free_block")
+      .value(memory.shutdownLargestFreeBlock);
+  json.key("stack_high_water_mark").value(memory.stackHighWaterMark);
+  json.key("samples").value(memory.samples);
+  json.endObject();
+
+  json.key("server").beginObject();
+  json.key("connections").value(server.connections);
+  json.key("peak_connections").value(server.peakConnections);
+  json.key("accepted").value(server.accepted);
+  json.key("requests").value(server.requests);
+  json.key("write_calls").value(server.writeCalls);
+  json.key("bytes_written").value(server.bytesWritten);
+  json.key("overflows").value(server.overflows);
+  json.endObject();
+
+  json.key("responses").beginObject();
+  json.key("responses").value(responses.responses);
+  json.key("errors").value(responses.errors);
+  json.key("segments").value(responses.segments);
+  json.key("bytes").value(responses.bytes);
+  json.endObject();
+
+  json.key("probes").beginObject();
+  json.key("android").value(probes.android);
+  json.key("apple").value(probes.apple);
+  json.key("windows").value(probes.windows);
+  json.key("other").value(probes.other);
+  json.key("pages").value(probes.pages);
+  json.endObject();
+
+  json.key("events").beginObject();
+  json.key("streams").value(events.streams);
+  json.key("opened").value(events.opened);
+  json.key("events").value(events.events);
+  json.key("bytes").value(events.bytes);
+  json.endObject();
+
+  json.key("pump").beginObject();
+  json.key("busy_us").value(pump.busyMicros);
+  json.key("idle_us").value(pump.idleMicros);
+  json.key("iterations").value(pump.iterations);
+  json.key("sleeps").value(pump.sleeps);
+  json.endObject();
+
+  json.key("latency_bounds_us").beginArray();
+  for (size_t i = 0; i < RouteStats::LATENCY_BUCKETS - 1; ++i) {
+    json.value(RouteStats::LATENCY_BOUNDS[i]);
+  }
+  json.endArray();
+
+  json.key("routes").beginArray();
+  for (size_t i = 0; i < _routeMetrics->count(); ++i) {
+    RouteStats route;
+    _routeMetrics->get(i, route);
+    json.beginObject();
+    json.key("route").value(route.route);
+    json.key("requests").value(route.requests);
+    json.key("errors").value(route.errors);
+    json.key("bytes").value(route.bytes);
+    json.key("latency").beginArray();
+    for (size_t j = 0; j < RouteStats::LATENCY_BUCKETS; ++j) {
+      json.value(route.latency[j]);
+    }
+    json.endArray();
+    json.endObject();
+  }
+  json.endArray();
+
+  json.endObject();
+  response.end();
 }
 
 /**
- * @brief Sends a success response to the HTTP client after a successful Wi-Fi
- * connection.
+ * @brief Samples the platform's memory and folds it into the memory
+ * statistics.
+ *
+ * @param servingTask Whether the caller runs on the task serving the portal,
+ * whose stack high-water mark is then recorded as well.
+ *
+ * @return The sample.
  */
-void WiFiProvisioner::handleSuccesfulConnection() {
-  JsonDocument doc;
-  doc["success"] = true;
+WiFiProvisionerPlatform::Memory
+WiFiProvisioner::sampleMemory(bool servingTask) {
+  WiFiProvisionerPlatform::Memory memory = _platform.memory();
+  std::lock_guard<PumpTask> guard(*_pumpTask);
+  if (_memoryStats.samples == 0 || memory.freeHeap < _memoryStats.minFreeHeap) {
+    _memoryStats.minFreeHeap = memory.freeHeap;
+  }
+  if (_memoryStats.samples == 0 ||
+      memory.largestFreeBlock < _memoryStats.minLargestFreeBlock) {
+    _memoryStats.minLargestFreeBlock = memory.largestFreeBlock;
+  }
+  if (servingTask && memory.stackHighWaterMark > 0 &&
+      (_memoryStats.stackHighWaterMark == 0 ||
+       memory.stackHighWaterMark < _memoryStats.stackHighWaterMark)) {
+    _memoryStats.stackHighWaterMark = memory.stackHighWaterMark;
+  }
+  _memoryStats.samples++;
+  return memory;
+}
 
-  WiFiClient client = _server->client();
+/**
+ * @brief Stores the credentials of the network the station has just joined,
+ * together with its access point and lease, for `reconnect()`.
+ */
+void WiFiProvisioner::storeCredentials(const char *ssid,
+                                       const char *password) {
+  CredentialStore *store = _platform.credentialStore();
+  if (store == nullptr) {
+    return;
+  }
 
-  sendHeader(client, 200, "application/json", measureJson(doc));
+  CredentialStore::Credentials credentials;
+  memset(&credentials, 0, sizeof(credentials));
+  strncpy(credentials.ssid, ssid, sizeof(credentials.ssid) - 1);
+  if (password) {
+    strncpy(credentials.password, password, sizeof(credentials.password) - 1);
+  }
+  if (!_platform.radio().link(credentials.link)) {
+    memset(&credentials.link, 0, sizeof(credentials.link));
+  }
+  if (!store->save(credentials)) {
+    WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
+                               "Failed to store credentials");
+  }
+}
 
-  serializeJson(doc, client);
-  client.flush();
-  client.stop();
+/**
+ * @brief Passes up to `maxEntries` queued log messages to the log callback,
+ * or prints them to `Serial` if none is registered.
+ */
+void WiFiProvisioner::flushLog(size_t maxEntries) {
+#if WIFI_PROVISIONER_LOG_LEVEL < WIFI_PROVISIONER_LOG_NONE
+  Logger::drain(logCallback, maxEntries);
+#endif
 }
 
 /**
- * @brief Sends a failure response to the HTTP client when a Wi-Fi connection
- * or input check attempt fails.
+ * @brief Sends a generic HTTP 400 Bad Request response.
  *
- * @param reason The reason for the failure (e.g., "ssid" or "code").
+ * @param response The response of the current request.
  */
-void WiFiProvisioner::handleUnsuccessfulConnection(const char *reason) {
-  JsonDocument doc;
-  doc["success"] = false;
-  doc["reason"] = reason;
-
-  WiFiClient client = _server->client();
+void WiFiProvisioner::sendBadRequestResponse(ResponseWriter &response) {
+  sendHeader(response, 400, "text/html", 0);
 
-  sendHeader(client, 200, "application/json", measureJson(doc));
-
-  serializeJson(doc, client);
-  client.flush();
-  client.stop();
+  WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_WARN,
+                             "Sent 400 Bad Request response to client");
 
-  WiFi.disconnect(false, true);
+  response.end();
 }
 
 /**
@@ -869,16 +2406,16 @@ void WiFiProvisioner::handleUnsuccessfulConnection(const char *reason) {
  * again.
  */
 void WiFiProvisioner::handleResetRequest() {
+  clearCredentials();
   if (factoryResetCallback) {
     factoryResetCallback();
   }
+  // Let `onProvision` see the cleared settings before the page reloads
+  invalidateConfig();
   WIFI_PROVISIONER_DEBUG_LOG(WIFI_PROVISIONER_LOG_INFO,
                              "Factory reset completed. Reloading UI.");
 
-  WiFiClient client = _server->client();
-
-  sendHeader(client, 200, "text/html", 0);
-
-  client.flush();
-  client.stop();
+  ResponseWriter response(*_server, _responseStats);
+  sendHeader(response, 200, "text/html", 0);
+  response.end();
 }
@@ -1,11 +1,29 @@
 #ifndef WIFIPROVISIONER_H
 #define WIFIPROVISIONER_H
 
+#include "WiFiProvisionerPlatform.h"
 #include <IPAddress.h>
+#include <atomic>
 #include <functional>
 
-class WebServer;
-class DNSServer;
+#define WIFI_PROVISIONER_LOG_DEBUG 0
+#define WIFI_PROVISIONER_LOG_INFO 1
+#define WIFI_PROVISIONER_LOG_WARN 2
+#define WIFI_PROVISIONER_LOG_ERROR 3
+#define WIFI_PROVISIONER_LOG_NONE 4
+
+#ifndef WIFI_PROVISIONER_LOG_LEVEL
+#define WIFI_PROVISIONER_LOG_LEVEL WIFI_PROVISIONER_LOG_INFO // Least level built
+#endif
+
+class PageCache;
+class ScanEngine;
+class Connector;
+class PumpTask;
+class IdlePump;
+class ResponseWriter;
+class RouteMetrics;
+class EventHub;
 
 class WiFiProvisioner {
 public:
@@ -47,51 +65,212 @@ public:
         bool showInputField = false, bool showResetField = true);
   };
 
+  struct TaskOptions {
+    uint32_t stackSize; // Stack size of the provisioning task in bytes
+    unsigned priority;  // FreeRTOS priority of the provisioning task
+    int core;           // Core to pin the task to, -1 for no affinity
+
+    TaskOptions(uint32_t stackSize = 8192, unsigned priority = 1,
+                int core = -1);
+  };
+
+  struct PageCacheStats {
+    size_t size;     // Size of the rendered page in bytes
+    size_t gzipSize; // Size of the gzip encoded page in bytes
+    uint32_t hits;   // Requests served from the rendered page
+    uint32_t misses; // Requests that had to render the page first
+  };
+
+  struct PumpStats {
+    uint64_t busyMicros; // Time spent serving requests in microseconds
+    uint64_t idleMicros; // Time spent yielding or sleeping in microseconds
+    uint32_t iterations; // Number of loop iterations
+    uint32_t sleeps;     // Number of iterations that slept
+    float dutyCycle;     // Fraction of time spent serving, 0.0 to 1.0
+  };
+
+  using ServerStats = WiFiProvisionerPlatform::HttpServer::Stats;
+
+  struct ResponseStats {
+    uint32_t responses; // Responses sent
+    uint32_t errors;    // Responses with a 4xx or 5xx status
+    uint32_t segments;  // Buffer-sized segments handed to the server
+    uint64_t bytes;     // Response bytes including headers
+  };
+
+  struct RouteStats {
+    // Latency buckets, the last one counting requests slower than the last
+    // bound
+    static constexpr size_t LATENCY_BUCKETS = 9;
+    // Upper bounds of the latency buckets in microseconds
+    static const uint32_t LATENCY_BOUNDS[LATENCY_BUCKETS - 1];
+
+    const char *route;                 // Path, or "*" for unknown paths
+    uint32_t requests;                 // Requests handled
+    uint32_t errors;                   // Responses with a 4xx or 5xx status
+    uint32_t bytes;                    // Response bytes, wraps after 4 GiB
+    uint32_t latency[LATENCY_BUCKETS]; // Requests per handler latency bucket
+  };
+
+  struct ProbeStats {
+    uint32_t android; // Connectivity checks from Android and Chrome OS
+    uint32_t apple;   // Connectivity checks from iOS and macOS
+    uint32_t windows; // Connectivity checks from Windows
+    uint32_t other;   // Connectivity checks from Firefox and Linux
+    uint32_t pages;   // Requests served the page, not counting 304s
+  };
+
+  struct EventStats {
+    uint32_t streams; // `/events` streams open right now
+    uint32_t opened;  // Streams opened
+    uint32_t events;  // Events sent, counted once per stream
+    uint64_t bytes;   // Event bytes handed to the server
+  };
+
+  struct ReconnectStats {
+    bool stored;                   // Whether credentials were stored
+    bool connected;                // Whether the stored network was joined
+    bool fastPath;                 // Joined on the stored access point
+    unsigned long timeToConnected; // Milliseconds until joined or given up
+  };
+
+  struct MemoryStats {
+    size_t startFreeHeap;            // Free heap when provisioning started
+    size_t startLargestFreeBlock;    // Largest free block at that time
+    size_t minFreeHeap;              // Least free heap seen at any sample
+    size_t minLargestFreeBlock;      // Smallest largest free block seen
+    size_t shutdownFreeHeap;         // Free heap after shutting down
+    size_t shutdownLargestFreeBlock; // Largest free block at that time
+    size_t stackHighWaterMark;       // Least unused stack of the serving task
+    uint32_t samples;                // Samples taken
+  };
+
   using ProvisionCallback = std::function<void()>;
+  using PageViewCallback = std::function<void()>;
   using InputCheckCallback = std::function<bool(const char *)>;
   using SuccessCallback =
       std::function<void(const char *, const char *, const char *)>;
   using FactoryResetCallback = std::function<void()>;
+  using CompleteCallback = std::function<void(bool)>;
+  using LogCallback = std::function<void(int, const char *)>;
 
   explicit WiFiProvisioner(const Config &config = Config());
+  WiFiProvisioner(const Config &config, WiFiProvisionerPlatform &platform);
   ~WiFiProvisioner();
 
   Config &getConfig();
+  void invalidateConfig();
+  PageCacheStats getPageCacheStats() const;
 
   bool startProvisioning();
+  bool startProvisioningAsync(const TaskOptions &options = TaskOptions());
+  bool reconnect();
+  bool connect();
+  void clearCredentials();
+  bool isProvisioning() const;
+  void stop();
 
   WiFiProvisioner &onProvision(ProvisionCallback callback);
+  WiFiProvisioner &onPageView(PageViewCallback callback);
   WiFiProvisioner &onInputCheck(InputCheckCallback callback);
   WiFiProvisioner &onFactoryReset(FactoryResetCallback callback);
   WiFiProvisioner &onSuccess(SuccessCallback callback);
+  WiFiProvisioner &onComplete(CompleteCallback callback);
+  WiFiProvisioner &onLog(LogCallback callback);
+
+  WiFiProvisioner &setScanCacheTtl(unsigned long ttl);
+  WiFiProvisioner &setScanLimit(size_t limit);
+  WiFiProvisioner &setShutdownGracePeriod(unsigned long gracePeriod);
+  WiFiProvisioner &setReconnectBudget(unsigned long budget);
+  WiFiProvisioner &setConnectionTimeout(unsigned long timeout,
+                                        unsigned long settleDelay = 100);
+  WiFiProvisioner &setKeepAlive(unsigned long idleTimeout,
+                                size_t maxConnections = 4);
+  WiFiProvisioner &setIdleBackoff(unsigned long shortSleepAfter,
+                                  unsigned long longSleepAfter,
+                                  unsigned long longSleep);
+  PumpStats getPumpStats() const;
+  ServerStats getServerStats() const;
+  ResponseStats getResponseStats() const;
+  ProbeStats getProbeStats() const;
+  EventStats getEventStats() const;
+  ReconnectStats getReconnectStats() const;
+  MemoryStats getMemoryStats() const;
+  size_t getRouteStats(RouteStats *stats, size_t capacity) const;
+  WiFiProvisioner &setStatsEndpoint(bool enabled);
 
 private:
+  bool beginProvisioning();
+  bool finishProvisioning();
   void loop();
-  bool connect(const char *ssid, const char *password);
+  void advanceConnection();
+  void publishEvents();
+  void publishStats();
   void releaseResources();
+  void refreshConfig();
   void handleRootRequest();
+  void handleProbeRequest();
   void handleResetRequest();
   void handleUpdateRequest();
   void handleConfigureRequest();
-  void sendBadRequestResponse();
-  void handleSuccesfulConnection();
-  void handleUnsuccessfulConnection(const char *reason);
+  void handleStatusRequest();
+  void handleEventsRequest();
+  void handleCompleteRequest();
+  void handleStatsRequest();
+  void sendBadRequestResponse(ResponseWriter &response);
+  void flushLog(size_t maxEntries);
+  void storeCredentials(const char *ssid, const char *password);
+  WiFiProvisionerPlatform::Memory sampleMemory(bool servingTask);
 
   ProvisionCallback provisionCallback;
+  PageViewCallback pageViewCallback;
   InputCheckCallback inputCheckCallback;
   SuccessCallback onSuccessCallback;
   FactoryResetCallback factoryResetCallback;
+  CompleteCallback onCompleteCallback;
+  LogCallback logCallback;
 
   Config _config;
-  WebServer *_server;
-  DNSServer *_dnsServer;
+  WiFiProvisionerPlatform &_platform;
+  WiFiProvisionerPlatform::HttpServer *_server;
+  WiFiProvisionerPlatform::DnsServer *_dnsServer;
+  PageCache *_pageCache;
+  ScanEngine *_scanEngine;
+  Connector *_connector;
+  PumpTask *_pumpTask;
+  IdlePump *_idlePump;
+  RouteMetrics *_routeMetrics;
+  EventHub *_eventHub;
   IPAddress _apIP;
   IPAddress _netMsk;
   uint16_t _dnsPort;
   unsigned int _serverPort;
-  unsigned int _wifiDelay;
-  unsigned int _wifiConnectionTimeout;
-  bool _serverLoopFlag;
+  unsigned long _wifiDelay;
+  unsigned long _wifiConnectionTimeout;
+  std::atomic<bool> _serverLoopFlag;
+  std::atomic<bool> _provisioning;
+  std::atomic<bool> _configInvalidated;
+  bool _provisioned;
+  bool _requestHandled;
+  unsigned long _shutdownGracePeriod;
+  unsigned long _reconnectBudget;
+  ReconnectStats _reconnectStats;
+  unsigned long _keepAliveTimeout;
+  size_t _keepAliveConnections;
+  ServerStats _serverStats;
+  ResponseStats _responseStats;
+  ProbeStats _probeStats;
+  MemoryStats _memoryStats;
+  ResponseStats _responseSnapshot; // Copies for other tasks, see publishStats()
+  ProbeStats _probeSnapshot;
+  EventStats _eventSnapshot;
+  PageCacheStats _pageCacheSnapshot;
+  bool _statsEndpoint;
+  unsigned long _successAt;
+  bool _shutdownPending;
+  uint32_t _publishedScanVersion; // Scan version the streams have
+  uint32_t _publishedJob;         // Connection job the streams know of
+  int _publishedState;            // State of that job
 };
 
 #endif // WIFIPROVISIONER_H
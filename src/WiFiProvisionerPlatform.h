@@ -0,0 +1,294 @@
+#ifndef WIFIPROVISIONER_PLATFORM_H
+#define WIFIPROVISIONER_PLATFORM_H
+
+#include <IPAddress.h>
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief The hardware and network services `WiFiProvisioner` runs on.
+ *
+ * The provisioning logic only talks to the radio, the HTTP server and the DNS
+ * responder through these interfaces. On ESP32 they are backed by the core's
+ * `WiFi` and `WiFiUDP` and by a server that multiplexes several connections
+ * on lwIP sockets, and `defaultPlatform()` returns that implementation.
+ * Defining `WIFI_PROVISIONER_SOCKET_SERVER` to `0` uses the core's
+ * `WebServer` instead, which serves one client at a time. Other
+ * implementations, such as the Linux backend in `extras/host`, allow the
+ * request handlers to run off-device.
+ */
+class WiFiProvisionerPlatform {
+public:
+  /**
+   * @brief The Wi-Fi radio: access point, station and scanning.
+   */
+  class Radio {
+  public:
+    static constexpr int16_t SCAN_RUNNING = -1;
+    static constexpr int16_t SCAN_FAILED = -2;
+
+    struct Network {
+      char ssid[33];    // SSID, at most 32 bytes plus terminator
+      int32_t rssi;     // Signal strength in dBm
+      bool open;        // Whether the network needs no password
+      uint8_t bssid[6]; // MAC address of the access point
+      int32_t channel;  // Primary channel of the access point
+    };
+
+    // What is needed to join the same access point again without scanning
+    struct Link {
+      uint8_t bssid[6];   // MAC address of the access point
+      int32_t channel;    // Primary channel, 0 if unknown
+      uint8_t ip[4];      // Station address from the last lease, 0 for DHCP
+      uint8_t gateway[4]; // Gateway from the last lease
+      uint8_t subnet[4];  // Subnet mask from the last lease
+      uint8_t dns[4];     // DNS server from the last lease
+      uint32_t leaseEnd;  // Unix time the lease ends, 0 if unknown
+    };
+
+    virtual ~Radio() {}
+
+    virtual bool startAccessPoint(const char *name, const IPAddress &ip,
+                                  const IPAddress &netmask) = 0;
+    virtual void stopAccessPoint() = 0;
+    virtual IPAddress accessPointIP() = 0;
+
+    virtual bool startScan() = 0;
+    virtual int16_t scanComplete() = 0;
+    virtual bool scanResult(size_t index, Network &network) = 0;
+    virtual void scanDelete() = 0;
+
+    virtual void begin(const char *ssid, const char *password) = 0;
+    virtual void disconnect() = 0;
+    virtual bool isConnected() = 0;
+
+    /**
+     * @brief Describes the access point and lease of the current connection.
+     *
+     * @return `false` if the station is not connected or the radio cannot
+     * tell.
+     */
+    virtual bool link(Link &link) { return false; }
+
+    /**
+     * @brief Joins a network on a known access point and channel without
+     * scanning, using the lease in `link` as a static address if it has not
+     * ended yet, and DHCP otherwise. Radios that cannot do so join like
+     * `begin()`.
+     */
+    virtual void rejoin(const char *ssid, const char *password,
+                        const Link &link) {
+      begin(ssid, password);
+    }
+  };
+
+  /**
+   * @brief An HTTP server running one request handler at a time.
+   *
+   * Handlers registered with `on()` run from `handleClient()`. While a
+   * handler runs, the request accessors describe the current request and
+   * `write()` sends response bytes to its client. Strings returned by the
+   * accessors stay valid until the next accessor call. A server may keep
+   * several connections open and serve requests from them in turn, and may
+   * queue response bytes and send them from later `handleClient()` calls.
+   *
+   * Servers that support persistent connections keep the connection open
+   * after `endResponse()` when `keepAlive()` returned `true` for the request,
+   * and read the next request, including pipelined ones, from it. Such
+   * responses must carry a `Content-Length` or use chunked transfer encoding.
+   *
+   * Servers that support streams can keep the connection of a request open
+   * after its response as an event stream, whose body is sent in pieces from
+   * outside of `handleClient()` until either side closes it.
+   */
+  class HttpServer {
+  public:
+    enum Method { ANY, GET, POST };
+    using Handler = std::function<void()>;
+
+    struct Stats {
+      uint32_t connections;     // Connections open right now
+      uint32_t peakConnections; // Most connections open at the same time
+      uint32_t accepted;        // Connections accepted
+      uint32_t requests;        // Requests served
+      uint32_t writeCalls;      // Socket send calls
+      uint64_t bytesWritten;    // Response bytes handed to the socket
+      uint32_t overflows;       // Connections closed as their queue was full
+    };
+
+    static constexpr uint32_t NO_STREAM = 0;
+
+    virtual ~HttpServer() {}
+
+    virtual void on(const char *uri, Method method, Handler handler) = 0;
+    virtual void onNotFound(Handler handler) = 0;
+    virtual void collectHeaders(const char *names[], size_t count) = 0;
+    virtual bool begin() = 0;
+    virtual void stop() = 0;
+    virtual void handleClient() = 0;
+
+    virtual bool hasArg(const char *name) = 0;
+    virtual const char *arg(const char *name) = 0;
+    virtual const char *header(const char *name) = 0;
+    virtual const char *uri() = 0;
+    virtual bool clientConnected() = 0;
+
+    virtual size_t write(const uint8_t *data, size_t length) = 0;
+    virtual void endResponse() = 0;
+
+    /**
+     * @brief Enables persistent connections.
+     *
+     * @param idleTimeout How long an idle connection is kept open in
+     * milliseconds, `0` disables persistent connections.
+     * @param maxConnections How many connections may be open at once.
+     *
+     * @return `false` if the server does not support persistent connections.
+     */
+    virtual bool setKeepAlive(unsigned long idleTimeout,
+                              size_t maxConnections) {
+      return false;
+    }
+
+    /**
+     * @brief Returns whether the connection of the current request stays open
+     * after `endResponse()`.
+     */
+    virtual bool keepAlive() { return false; }
+
+    /**
+     * @brief Prepares the current response for a body whose length is not
+     * known up front.
+     *
+     * @return `true` if the body may be sent with chunked transfer encoding.
+     * Otherwise the body ends when the connection is closed, so the server
+     * closes it after the response and `keepAlive()` returns `false` for the
+     * rest of the request. Further calls return the same answer.
+     */
+    virtual bool beginChunked() { return false; }
+
+    /**
+     * @brief Limits the size of request bodies.
+     *
+     * A request whose `Content-Length` exceeds the limit is answered with
+     * `413 Payload Too Large` before its body is read, and its handler does
+     * not run.
+     *
+     * @return `false` if the server does not support the limit.
+     */
+    virtual bool setMaxBodySize(size_t size) { return false; }
+
+    /**
+     * @brief Sends response bytes like `write()`, but lets the server queue a
+     * pointer to them instead of a copy if the client does not take them at
+     * once.
+     *
+     * The bytes must stay valid and unchanged until the response has been
+     * sent or `detachBorrowed()` has been called.
+     */
+    virtual size_t writeBorrowed(const uint8_t *data, size_t length) {
+      return write(data, length);
+    }
+
+    /**
+     * @brief Copies the bytes still queued from `writeBorrowed()` calls, after
+     * which their buffers may be changed or freed.
+     */
+    virtual void detachBorrowed() {}
+
+    /**
+     * @brief Turns the connection of the current request into a stream.
+     *
+     * The response is written and ended as usual, without a length, after
+     * which the connection stays open and reads no further requests. At most
+     * `queueSize` response bytes may wait for the client; a stream that would
+     * queue more is closed instead.
+     *
+     * @return The id of the stream, or `NO_STREAM` if the server does not
+     * support streams.
+     */
+    virtual uint32_t beginStream(size_t queueSize) { return NO_STREAM; }
+
+    /**
+     * @brief Makes a stream the target of `write()` outside of a request,
+     * until `endResponse()` is called. Must not be called from a handler.
+     *
+     * @return `false` if the stream has been closed.
+     */
+    virtual bool resumeStream(uint32_t stream) { return false; }
+
+    virtual void closeStream(uint32_t stream) {}
+
+    /**
+     * @brief Returns the connection and I/O counters of the server, or all
+     * zeros if the server does not keep them.
+     */
+    virtual Stats stats() { return Stats(); }
+  };
+
+  /**
+   * @brief A DNS responder that resolves every name to one address.
+   */
+  class DnsServer {
+  public:
+    virtual ~DnsServer() {}
+
+    virtual bool start(uint16_t port, const IPAddress &ip) = 0;
+    virtual void stop() = 0;
+
+    /**
+     * @brief Answers one pending query without blocking.
+     *
+     * @return `true` if a packet was received, so more may be waiting.
+     */
+    virtual bool processNextRequest() = 0;
+  };
+
+  /**
+   * @brief Persistent storage for the credentials of the last network
+   * joined.
+   */
+  class CredentialStore {
+  public:
+    struct Credentials {
+      char ssid[33];     // SSID, at most 32 bytes plus terminator
+      char password[65]; // Password, empty for open networks
+      Radio::Link link;  // How the network was last joined
+    };
+
+    virtual ~CredentialStore() {}
+
+    virtual bool load(Credentials &credentials) = 0;
+    virtual bool save(const Credentials &credentials) = 0;
+    virtual void clear() = 0;
+  };
+
+  struct Memory {
+    size_t freeHeap;           // Free heap in bytes
+    size_t largestFreeBlock;   // Largest block that can be allocated
+    size_t stackHighWaterMark; // Least free stack of the calling task so far
+  };
+
+  virtual ~WiFiProvisionerPlatform() {}
+
+  virtual Radio &radio() = 0;
+  virtual HttpServer *createHttpServer(uint16_t port) = 0;
+  virtual DnsServer *createDnsServer() = 0;
+
+  /**
+   * @brief Returns the current heap state and the stack high-water mark of
+   * the calling task. Values the platform cannot measure are `0`.
+   */
+  virtual Memory memory() { return Memory(); }
+
+  /**
+   * @brief Returns the credential store, or `nullptr` if the platform cannot
+   * store credentials.
+   */
+  virtual CredentialStore *credentialStore() { return nullptr; }
+
+  static WiFiProvisionerPlatform &defaultPlatform();
+};
+
+#endif // WIFIPROVISIONER_PLATFORM_H
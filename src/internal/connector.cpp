@@ -0,0 +1,183 @@
+#include "connector.h"
+#include <Arduino.h>
+
+namespace {
+
+/**
+ * @brief Copies a string into a fixed-size buffer.
+ *
+ * @return `false` if the string does not fit, in which case the buffer is left
+ * empty.
+ */
+template <size_t N> bool copyString(char (&buffer)[N], const char *value) {
+  size_t length = value ? strlen(value) : 0;
+  if (length >= N) {
+    buffer[0] = '\0';
+    return false;
+  }
+  memcpy(buffer, value ? value : "", length + 1);
+  return true;
+}
+
+} // namespace
+
+Connector::Connector(WiFiProvisionerPlatform::Radio &radio)
+    : _radio(radio), _ssid(), _password(), _input(), _hasPassword(false),
+      _hasInput(false), _state(IDLE), _reason(nullptr), _id(0), _begun(false),
+      _timeout(10000), _settleDelay(100), _stateChangedAt(0) {}
+
+/**
+ * @brief Sets how long the station may take to connect before the job fails.
+ *
+ * @param timeout The connection timeout in milliseconds.
+ */
+void Connector::setTimeout(unsigned long timeout) { _timeout = timeout; }
+
+/**
+ * @brief Sets how long to wait after disconnecting before joining the network.
+ *
+ * @param settleDelay The delay in milliseconds.
+ */
+void Connector::setSettleDelay(unsigned long settleDelay) {
+  _settleDelay = settleDelay;
+}
+
+/**
+ * @brief Starts a new connection attempt.
+ *
+ * The station is disconnected right away, and the network is joined by a later
+ * `advance()` call once the settle delay has passed and the radio is free.
+ *
+ * @param ssid The SSID of the Wi-Fi network.
+ * @param password The password for the Wi-Fi network, or `nullptr` for open
+ * networks.
+ * @param input The custom input to verify after connecting, or `nullptr`.
+ *
+ * @return The id of the new job, or `0` if a job is already in progress or
+ * the arguments do not fit the credential buffers.
+ */
+uint32_t Connector::begin(const char *ssid, const char *password,
+                          const char *input) {
+  if (isActive() || !ssid || ssid[0] == '\0') {
+    return 0;
+  }
+
+  if (!copyString(_ssid, ssid) || !copyString(_password, password) ||
+      !copyString(_input, input)) {
+    return 0;
+  }
+  _hasPassword = password != nullptr && password[0] != '\0';
+  _hasInput = input != nullptr;
+
+  _radio.disconnect();
+
+  _id++;
+  _state = ASSOCIATING;
+  _reason = nullptr;
+  _begun = false;
+  _stateChangedAt = millis();
+  return _id;
+}
+
+/**
+ * @brief Advances the connection attempt without blocking.
+ *
+ * @param radioAvailable Whether the radio is free to join a network, e.g. no
+ * scan is running.
+ */
+void Connector::advance(bool radioAvailable) {
+  if (_state != ASSOCIATING) {
+    return;
+  }
+
+  unsigned long now = millis();
+
+  if (!_begun) {
+    if (!radioAvailable || now - _stateChangedAt < _settleDelay) {
+      return;
+    }
+
+    _radio.begin(_ssid, _hasPassword ? _password : nullptr);
+    _begun = true;
+    _stateChangedAt = now;
+    return;
+  }
+
+  if (_radio.isConnected()) {
+    _state = GOT_IP;
+    _stateChangedAt = now;
+  } else if (now - _stateChangedAt >= _timeout) {
+    fail("ssid");
+  }
+}
+
+/**
+ * @brief Completes a job that has reached `GOT_IP`.
+ *
+ * @param success `true` to mark the job verified, `false` to fail it with the
+ * reason "code" and disconnect the station.
+ */
+void Connector::verify(bool success) {
+  if (_state != GOT_IP) {
+    return;
+  }
+
+  if (success) {
+    _state = VERIFIED;
+    _stateChangedAt = millis();
+  } else {
+    fail("code");
+  }
+}
+
+/**
+ * @brief Forgets the current job without touching the station connection.
+ */
+void Connector::reset() {
+  _state = IDLE;
+  _reason = nullptr;
+  _begun = false;
+  _password[0] = '\0';
+  _input[0] = '\0';
+}
+
+void Connector::fail(const char *reason) {
+  _state = FAILED;
+  _reason = reason;
+  _stateChangedAt = millis();
+  _radio.disconnect();
+}
+
+bool Connector::isActive() const {
+  return _state == ASSOCIATING || _state == GOT_IP;
+}
+
+uint32_t Connector::id() const { return _id; }
+
+Connector::State Connector::state() const { return _state; }
+
+const char *Connector::reason() const { return _reason; }
+
+const char *Connector::ssid() const { return _ssid; }
+
+const char *Connector::password() const {
+  return _hasPassword ? _password : nullptr;
+}
+
+const char *Connector::input() const { return _hasInput ? _input : nullptr; }
+
+const char *Connector::stateName(State state) {
+  switch (state) {
+  case ASSOCIATING:
+    return "associating";
+  case GOT_IP:
+    return "got_ip";
+  case VERIFIED:
+    return "verified";
+  case FAILED:
+    return "failed";
+  case IDLE:
+  default:
+    return "idle";
+  }
+}
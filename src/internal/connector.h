@@ -0,0 +1,64 @@
+#ifndef CONNECTOR_H
+#define CONNECTOR_H
+
+#include "../WiFiProvisionerPlatform.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef WIFI_PROVISIONER_MAX_INPUT_LENGTH
+#define WIFI_PROVISIONER_MAX_INPUT_LENGTH 64 // Longest accepted custom input
+#endif
+
+/**
+ * @brief Non-blocking state machine for a single Wi-Fi connection attempt.
+ *
+ * A connection attempt ("job") moves through the states
+ * `IDLE -> ASSOCIATING -> GOT_IP -> VERIFIED` or ends in `FAILED`. The owner
+ * calls `advance()` on every loop iteration instead of waiting for the
+ * station to connect, and confirms or rejects the connection with `verify()`
+ * once it has reached `GOT_IP`. The credentials are copied into fixed-size
+ * buffers so they outlive the request that started the job.
+ */
+class Connector {
+public:
+  enum State { IDLE, ASSOCIATING, GOT_IP, VERIFIED, FAILED };
+
+  explicit Connector(WiFiProvisionerPlatform::Radio &radio);
+
+  void setTimeout(unsigned long timeout);
+  void setSettleDelay(unsigned long settleDelay);
+
+  uint32_t begin(const char *ssid, const char *password, const char *input);
+  void advance(bool radioAvailable);
+  void verify(bool success);
+  void reset();
+
+  bool isActive() const;
+  uint32_t id() const;
+  State state() const;
+  const char *reason() const;
+  const char *ssid() const;
+  const char *password() const;
+  const char *input() const;
+
+  static const char *stateName(State state);
+
+private:
+  void fail(const char *reason);
+
+  WiFiProvisionerPlatform::Radio &_radio;
+  char _ssid[33];
+  char _password[65];
+  char _input[WIFI_PROVISIONER_MAX_INPUT_LENGTH + 1];
+  bool _hasPassword;
+  bool _hasInput;
+  State _state;
+  const char *_reason;
+  uint32_t _id;
+  bool _begun;
+  unsigned long _timeout;
+  unsigned long _settleDelay;
+  unsigned long _stateChangedAt;
+};
+
+#endif // CONNECTOR_H
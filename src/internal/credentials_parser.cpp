@@ -0,0 +1,372 @@
+#include "credentials_parser.h"
+#include <string.h>
+
+namespace {
+
+/**
+ * @brief Appends a byte to a bounded string, counting it even when it does
+ * not fit.
+ */
+void put(char c, char *target, size_t capacity, size_t &length) {
+  if (target != nullptr && length < capacity) {
+    target[length] = c;
+  }
+  length++;
+}
+
+/**
+ * @brief Appends a code point to a bounded string as UTF-8.
+ */
+void putUtf8(uint32_t codePoint, char *target, size_t capacity,
+             size_t &length) {
+  if (codePoint < 0x80) {
+    put(codePoint, target, capacity, length);
+  } else if (codePoint < 0x800) {
+    put(0xc0 | (codePoint >> 6), target, capacity, length);
+    put(0x80 | (codePoint & 0x3f), target, capacity, length);
+  } else if (codePoint < 0x10000) {
+    put(0xe0 | (codePoint >> 12), target, capacity, length);
+    put(0x80 | ((codePoint >> 6) & 0x3f), target, capacity, length);
+    put(0x80 | (codePoint & 0x3f), target, capacity, length);
+  } else {
+    put(0xf0 | (codePoint >> 18), target, capacity, length);
+    put(0x80 | ((codePoint >> 12) & 0x3f), target, capacity, length);
+    put(0x80 | ((codePoint >> 6) & 0x3f), target, capacity, length);
+    put(0x80 | (codePoint & 0x3f), target, capacity, length);
+  }
+}
+
+} // namespace
+
+CredentialsParser::CredentialsParser()
+    : _position(nullptr), _end(nullptr), _maxInputLength(0), _error(OK),
+      _ssid(), _password(), _input(), _hasSsid(false), _hasPassword(false),
+      _hasInput(false) {}
+
+/**
+ * @brief Parses a request body.
+ *
+ * @param body The body, which need not be null-terminated.
+ * @param length The length of the body in bytes.
+ * @param maxInputLength The longest accepted `code`, capped at
+ * `WIFI_PROVISIONER_MAX_INPUT_LENGTH`.
+ *
+ * @return `OK` if the body starts with a well-formed JSON object whose
+ * credentials fit their buffers. Anything after the object is ignored.
+ */
+CredentialsParser::Result CredentialsParser::parse(const char *body,
+                                                   size_t length,
+                                                   size_t maxInputLength) {
+  _position = body;
+  _end = body + length;
+  _maxInputLength = maxInputLength < WIFI_PROVISIONER_MAX_INPUT_LENGTH
+                        ? maxInputLength
+                        : WIFI_PROVISIONER_MAX_INPUT_LENGTH;
+  _error = MALFORMED;
+  _hasSsid = false;
+  _hasPassword = false;
+  _hasInput = false;
+
+  skipWhitespace();
+  return parseObject(0) ? OK : _error;
+}
+
+/**
+ * @brief Returns the SSID, or `nullptr` if the body has none.
+ */
+const char *CredentialsParser::ssid() const {
+  return _hasSsid ? _ssid : nullptr;
+}
+
+/**
+ * @brief Returns the password, or `nullptr` if the body has none.
+ */
+const char *CredentialsParser::password() const {
+  return _hasPassword ? _password : nullptr;
+}
+
+/**
+ * @brief Returns the custom input, or `nullptr` if the body has none.
+ */
+const char *CredentialsParser::input() const {
+  return _hasInput ? _input : nullptr;
+}
+
+/**
+ * @brief Parses an object. The credentials are taken from the members of the
+ * top-level object only.
+ */
+bool CredentialsParser::parseObject(size_t depth) {
+  if (depth >= MAX_DEPTH || !consume('{')) {
+    return false;
+  }
+  skipWhitespace();
+  if (consume('}')) {
+    return true;
+  }
+
+  for (;;) {
+    skipWhitespace();
+    char key[9]; // Fits the longest credential name, "password"
+    size_t keyLength = 0;
+    if (!parseString(key, sizeof(key) - 1, keyLength)) {
+      return false;
+    }
+
+    char *target = nullptr;
+    size_t capacity = 0;
+    bool *found = nullptr;
+    if (depth == 0 && keyLength < sizeof(key)) {
+      if (strcmp(key, "ssid") == 0) {
+        target = _ssid;
+        capacity = sizeof(_ssid) - 1;
+        found = &_hasSsid;
+      } else if (strcmp(key, "password") == 0) {
+        target = _password;
+        capacity = sizeof(_password) - 1;
+        found = &_hasPassword;
+      } else if (strcmp(key, "code") == 0) {
+        target = _input;
+        capacity = _maxInputLength;
+        found = &_hasInput;
+      }
+    }
+
+    skipWhitespace();
+    if (!consume(':')) {
+      return false;
+    }
+    skipWhitespace();
+
+    if (target != nullptr && _position < _end && *_position == '"') {
+      size_t length = 0;
+      if (!parseString(target, capacity, length)) {
+        return false;
+      }
+      if (length > capacity) {
+        _error = TOO_LONG;
+        return false;
+      }
+      *found = true;
+    } else {
+      if (!parseValue(depth)) {
+        return false;
+      }
+      if (found != nullptr) {
+        *found = false;
+      }
+    }
+
+    skipWhitespace();
+    if (!consume(',')) {
+      return consume('}');
+    }
+  }
+}
+
+bool CredentialsParser::parseArray(size_t depth) {
+  if (depth >= MAX_DEPTH || !consume('[')) {
+    return false;
+  }
+  skipWhitespace();
+  if (consume(']')) {
+    return true;
+  }
+
+  for (;;) {
+    skipWhitespace();
+    if (!parseValue(depth)) {
+      return false;
+    }
+    skipWhitespace();
+    if (!consume(',')) {
+      return consume(']');
+    }
+  }
+}
+
+/**
+ * @brief Skips a value of any type.
+ *
+ * @param depth The nesting depth of the container holding the value.
+ */
+bool CredentialsParser::parseValue(size_t depth) {
+  if (_position >= _end) {
+    return false;
+  }
+
+  size_t length = 0;
+  switch (*_position) {
+  case '{':
+    return parseObject(depth + 1);
+  case '[':
+    return parseArray(depth + 1);
+  case '"':
+    return parseString(nullptr, 0, length);
+  case 't':
+    return parseLiteral("true");
+  case 'f':
+    return parseLiteral("false");
+  case 'n':
+    return parseLiteral("null");
+  default:
+    return parseNumber();
+  }
+}
+
+/**
+ * @brief Parses a string and decodes it into a bounded buffer.
+ *
+ * @param target The buffer of `capacity + 1` bytes receiving the decoded,
+ * null-terminated string, or `nullptr` to skip the string.
+ * @param capacity The most bytes stored in `target`.
+ * @param length Receives the decoded length, which exceeds `capacity` if the
+ * string was cut off.
+ *
+ * @return `false` if the string is malformed or contains a null character.
+ */
+bool CredentialsParser::parseString(char *target, size_t capacity,
+                                    size_t &length) {
+  if (!consume('"')) {
+    return false;
+  }
+
+  length = 0;
+  while (_position < _end) {
+    unsigned char c = *_position++;
+    if (c == '"') {
+      if (target != nullptr) {
+        target[length < capacity ? length : capacity] = '\0';
+      }
+      return true;
+    }
+    if (c < 0x20) {
+      return false;
+    }
+    if (c != '\\') {
+      put(c, target, capacity, length);
+      continue;
+    }
+
+    if (_position >= _end) {
+      return false;
+    }
+    char escape = *_position++;
+    switch (escape) {
+    case '"':
+    case '\\':
+    case '/':
+      put(escape, target, capacity, length);
+      break;
+    case 'b':
+      put('\b', target, capacity, length);
+      break;
+    case 'f':
+      put('\f', target, capacity, length);
+      break;
+    case 'n':
+      put('\n', target, capacity, length);
+      break;
+    case 'r':
+      put('\r', target, capacity, length);
+      break;
+    case 't':
+      put('\t', target, capacity, length);
+      break;
+    case 'u': {
+      uint32_t codePoint;
+      if (!readCodePoint(codePoint)) {
+        return false;
+      }
+      putUtf8(codePoint, target, capacity, length);
+      break;
+    }
+    default:
+      return false;
+    }
+  }
+  return false;
+}
+
+bool CredentialsParser::parseLiteral(const char *literal) {
+  size_t length = strlen(literal);
+  if (static_cast<size_t>(_end - _position) < length ||
+      strncmp(_position, literal, length) != 0) {
+    return false;
+  }
+  _position += length;
+  return true;
+}
+
+/**
+ * @brief Skips a number. Only the characters are checked, not the grammar.
+ */
+bool CredentialsParser::parseNumber() {
+  const char *start = _position;
+  bool digits = false;
+  while (_position < _end && strchr("+-.eE0123456789", *_position) &&
+         *_position != '\0') {
+    digits |= *_position >= '0' && *_position <= '9';
+    ++_position;
+  }
+  return _position > start && digits;
+}
+
+/**
+ * @brief Reads the code point of a `\u` escape whose `\u` has been consumed,
+ * combining surrogate pairs. Null characters and lone surrogates are
+ * rejected.
+ */
+bool CredentialsParser::readCodePoint(uint32_t &codePoint) {
+  if (!readHex(codePoint) || codePoint == 0 ||
+      (codePoint >= 0xdc00 && codePoint <= 0xdfff)) {
+    return false;
+  }
+  if (codePoint < 0xd800 || codePoint > 0xdbff) {
+    return true;
+  }
+
+  uint32_t low;
+  if (!consume('\\') || !consume('u') || !readHex(low) || low < 0xdc00 ||
+      low > 0xdfff) {
+    return false;
+  }
+  codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (low - 0xdc00);
+  return true;
+}
+
+bool CredentialsParser::readHex(uint32_t &value) {
+  if (_end - _position < 4) {
+    return false;
+  }
+  value = 0;
+  for (int i = 0; i < 4; ++i) {
+    char c = *_position++;
+    value <<= 4;
+    if (c >= '0' && c <= '9') {
+      value |= c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+      value |= c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+      value |= c - 'A' + 10;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+void CredentialsParser::skipWhitespace() {
+  while (_position < _end && (*_position == ' ' || *_position == '\t' ||
+                              *_position == '\n' || *_position == '\r')) {
+    ++_position;
+  }
+}
+
+bool CredentialsParser::consume(char c) {
+  if (_position < _end && *_position == c) {
+    ++_position;
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,67 @@
+#ifndef CREDENTIALS_PARSER_H
+#define CREDENTIALS_PARSER_H
+
+#include "connector.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef WIFI_PROVISIONER_MAX_BODY_SIZE
+#define WIFI_PROVISIONER_MAX_BODY_SIZE 1024 // Largest accepted request body
+#endif
+
+/**
+ * @brief Extracts the credentials from a `/configure` request body.
+ *
+ * The body is scanned once without building a document. Only the string
+ * members `ssid`, `password` and `code` of the top-level object are decoded,
+ * into fixed buffers sized to the 802.11 limits of 32 SSID bytes and 64
+ * passphrase bytes, and to the input length. Other members are skipped. A
+ * member that is `null` or not a string counts as missing, as with
+ * ArduinoJson. Nothing is allocated.
+ */
+class CredentialsParser {
+public:
+  enum Result {
+    OK,        // The body is a JSON object, credentials may still be missing
+    MALFORMED, // The body is not a JSON object
+    TOO_LONG,  // A credential does not fit its buffer
+  };
+
+  static constexpr size_t MAX_DEPTH = 10; // ArduinoJson's nesting limit
+
+  CredentialsParser();
+
+  Result parse(const char *body, size_t length, size_t maxInputLength);
+
+  const char *ssid() const;
+  const char *password() const;
+  const char *input() const;
+
+private:
+  CredentialsParser(const CredentialsParser &) = delete;
+  CredentialsParser &operator=(const CredentialsParser &) = delete;
+
+  bool parseObject(size_t depth);
+  bool parseArray(size_t depth);
+  bool parseValue(size_t depth);
+  bool parseString(char *target, size_t capacity, size_t &length);
+  bool parseLiteral(const char *literal);
+  bool parseNumber();
+  bool readCodePoint(uint32_t &codePoint);
+  bool readHex(uint32_t &value);
+  void skipWhitespace();
+  bool consume(char c);
+
+  const char *_position;
+  const char *_end;
+  size_t _maxInputLength;
+  Result _error;
+  char _ssid[33];
+  char _password[65];
+  char _input[WIFI_PROVISIONER_MAX_INPUT_LENGTH + 1];
+  bool _hasSsid;
+  bool _hasPassword;
+  bool _hasInput;
+};
+
+#endif // CREDENTIALS_PARSER_H
@@ -0,0 +1,51 @@
+#include "dns_responder.h"
+#include <string.h>
+
+/**
+ * @brief Turns a query into its answer.
+ *
+ * @param packet The query, which is overwritten with the answer.
+ * @param length The length of the query in bytes.
+ * @param capacity The size of `packet`, at least 16 bytes more than the
+ * question to fit the answer record.
+ * @param ip The address every name resolves to.
+ *
+ * @return The length of the answer, or `0` if the packet is not a query with
+ * a single question and is to be dropped.
+ */
+size_t DnsResponder::answer(uint8_t *packet, size_t length, size_t capacity,
+                            const IPAddress &ip) {
+  if (length < 12 || (packet[2] & 0x80) != 0 || packet[4] != 0 ||
+      packet[5] != 1) {
+    return 0;
+  }
+
+  // Skip the name of the single question
+  size_t position = 12;
+  while (position < length && packet[position] != 0) {
+    position += packet[position] + 1;
+  }
+  position += 5; // Terminator, type and class
+  if (position > length || position + 16 > capacity) {
+    return 0;
+  }
+  uint16_t type = (packet[position - 4] << 8) | packet[position - 3];
+  bool answer = type == 1 || type == 255;
+
+  packet[2] = 0x84 | (packet[2] & 0x01); // Response, authoritative, RD
+  packet[3] = 0x80;                      // Recursion available, no error
+  packet[6] = 0;
+  packet[7] = answer ? 1 : 0;
+  memset(packet + 8, 0, 4);
+
+  size_t responseLength = position;
+  if (answer) {
+    // Name pointer to the question, type A, class IN, TTL 60 s, address
+    const uint8_t record[] = {0xc0,  0x0c,  0x00,  0x01,  0x00, 0x01,
+                              0x00,  0x00,  0x00,  0x3c,  0x00, 0x04,
+                              ip[0], ip[1], ip[2], ip[3]};
+    memcpy(packet + position, record, sizeof(record));
+    responseLength += sizeof(record);
+  }
+  return responseLength;
+}
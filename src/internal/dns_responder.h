@@ -0,0 +1,24 @@
+#ifndef DNS_RESPONDER_H
+#define DNS_RESPONDER_H
+
+#include <IPAddress.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Answers DNS queries the way a captive portal does, resolving every
+ * name to one address.
+ *
+ * Queries for A records get the address, all other queries get an empty
+ * answer, so that clients fall back to IPv4 instead of timing out. The answer
+ * is built in place of the query, so the platforms only move datagrams.
+ */
+class DnsResponder {
+public:
+  static constexpr size_t MAX_PACKET_SIZE = 512; // Largest plain DNS message
+
+  static size_t answer(uint8_t *packet, size_t length, size_t capacity,
+                       const IPAddress &ip);
+};
+
+#endif // DNS_RESPONDER_H
@@ -0,0 +1,423 @@
+#if defined(ARDUINO_ARCH_ESP32)
+
+#include "../WiFiProvisionerPlatform.h"
+#include "dns_responder.h"
+#include "socket_http_server.h"
+#include <Preferences.h>
+#include <WebServer.h>
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include <esp_heap_caps.h>
+#include <esp_netif.h>
+#include <esp_netif_net_stack.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <lwip/dhcp.h>
+#include <time.h>
+
+namespace {
+
+const unsigned long WIFI_DELAY = 100;
+
+// Preferences namespace and key of the stored credentials
+const char PREFERENCES_NAMESPACE[] = "wifiprov";
+const char CREDENTIALS_KEY[] = "credentials";
+// Bumped whenever the layout of the stored credentials changes
+const uint8_t CREDENTIALS_VERSION = 2;
+// The system clock reads less than this until it has been set, e.g. by SNTP
+const time_t CLOCK_SET_AFTER = 1577836800; // 2020-01-01
+
+void copyAddress(uint8_t (&target)[4], const IPAddress &address) {
+  for (int i = 0; i < 4; ++i) {
+    target[i] = address[i];
+  }
+}
+
+IPAddress toAddress(const uint8_t (&address)[4]) {
+  return IPAddress(address[0], address[1], address[2], address[3]);
+}
+
+/**
+ * @brief Returns the time of day in Unix seconds, 0 if the clock is not set.
+ */
+uint32_t unixTime() {
+  time_t now = time(nullptr);
+  return now > CLOCK_SET_AFTER ? static_cast<uint32_t>(now) : 0;
+}
+
+/**
+ * @brief Returns the length of the station's DHCP lease in seconds, 0 if it
+ * holds none.
+ */
+uint32_t leaseLength() {
+  esp_netif_t *netif = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
+  if (netif == nullptr) {
+    return 0;
+  }
+  struct netif *lwip =
+      static_cast<struct netif *>(esp_netif_get_netif_impl(netif));
+  struct dhcp *dhcp = lwip ? netif_dhcp_data(lwip) : nullptr;
+  return dhcp && dhcp->state == DHCP_STATE_BOUND ? dhcp->offered_t0_lease : 0;
+}
+
+/**
+ * @brief Radio backed by the ESP32 core's `WiFi` object.
+ */
+class Esp32Radio : public WiFiProvisionerPlatform::Radio {
+public:
+  Esp32Radio() : _staticAddress(false), _leaseEnd(0) {}
+
+  bool startAccessPoint(const char *name, const IPAddress &ip,
+                        const IPAddress &netmask) override {
+    if (!WiFi.mode(WIFI_AP_STA)) {
+      return false;
+    }
+    delay(WIFI_DELAY);
+
+    if (!WiFi.softAPConfig(ip, ip, netmask) || !WiFi.softAP(name)) {
+      return false;
+    }
+    delay(WIFI_DELAY);
+    return true;
+  }
+
+  void stopAccessPoint() override {
+    if (WiFi.getMode() != WIFI_STA) {
+      WiFi.mode(WIFI_STA);
+      delay(WIFI_DELAY);
+    }
+  }
+
+  IPAddress accessPointIP() override { return WiFi.softAPIP(); }
+
+  bool startScan() override {
+    return WiFi.scanNetworks(true, false) != WIFI_SCAN_FAILED;
+  }
+
+  int16_t scanComplete() override { return WiFi.scanComplete(); }
+
+  bool scanResult(size_t index, Network &network) override {
+    if (index > UINT8_MAX) {
+      return false;
+    }
+    uint8_t i = static_cast<uint8_t>(index);
+
+    strncpy(network.ssid, WiFi.SSID(i).c_str(), sizeof(network.ssid) - 1);
+    network.ssid[sizeof(network.ssid) - 1] = '\0';
+    network.rssi = WiFi.RSSI(i);
+    network.open = WiFi.encryptionType(i) == WIFI_AUTH_OPEN;
+    const uint8_t *bssid = WiFi.BSSID(i);
+    if (bssid) {
+      memcpy(network.bssid, bssid, sizeof(network.bssid));
+    } else {
+      memset(network.bssid, 0, sizeof(network.bssid));
+    }
+    network.channel = WiFi.channel(i);
+    return true;
+  }
+
+  void scanDelete() override { WiFi.scanDelete(); }
+
+  void begin(const char *ssid, const char *password) override {
+    useDhcp();
+    if (password) {
+      WiFi.begin(ssid, password);
+    } else {
+      WiFi.begin(ssid);
+    }
+  }
+
+  void disconnect() override { WiFi.disconnect(false, true); }
+
+  bool isConnected() override { return WiFi.status() == WL_CONNECTED; }
+
+  bool link(Link &link) override {
+    if (!isConnected()) {
+      return false;
+    }
+    const uint8_t *bssid = WiFi.BSSID();
+    if (bssid == nullptr) {
+      return false;
+    }
+    memcpy(link.bssid, bssid, sizeof(link.bssid));
+    link.channel = WiFi.channel();
+    copyAddress(link.ip, WiFi.localIP());
+    copyAddress(link.gateway, WiFi.gatewayIP());
+    copyAddress(link.subnet, WiFi.subnetMask());
+    copyAddress(link.dns, WiFi.dnsIP());
+    // Read right after joining, so the lease started moments ago. A static
+    // address keeps the end of the lease it was taken from
+    uint32_t now = unixTime();
+    uint32_t lease = leaseLength();
+    if (_staticAddress) {
+      link.leaseEnd = _leaseEnd;
+    } else {
+      link.leaseEnd = now != 0 && lease != 0 ? now + lease : 0;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Joins the access point on its channel, which skips the scan of
+   * all channels, and configures the last lease statically, which skips
+   * DHCP.
+   *
+   * The lease is only used while the system clock shows it has not ended,
+   * as the DHCP server may have handed the address out again since. Without
+   * a set clock, or once it has ended, the address is requested over DHCP.
+   */
+  void rejoin(const char *ssid, const char *password,
+              const Link &link) override {
+    uint32_t now = unixTime();
+    if (link.ip[0] != 0 && now != 0 && now < link.leaseEnd) {
+      WiFi.config(toAddress(link.ip), toAddress(link.gateway),
+                  toAddress(link.subnet), toAddress(link.dns));
+      _staticAddress = true;
+      _leaseEnd = link.leaseEnd;
+    } else {
+      useDhcp();
+    }
+    WiFi.begin(ssid, password, link.channel, link.bssid);
+  }
+
+private:
+  /**
+   * @brief Switches back to DHCP after `rejoin()` configured a static
+   * address.
+   */
+  void useDhcp() {
+    if (_staticAddress) {
+      WiFi.config(IPAddress(), IPAddress(), IPAddress());
+      _staticAddress = false;
+    }
+  }
+
+  bool _staticAddress; // Whether `rejoin()` configured a static address
+  uint32_t _leaseEnd;  // Unix time the lease of the static address ends
+};
+
+/**
+ * @brief Credential store in the ESP32's non-volatile storage, written
+ * through `Preferences`.
+ */
+class Esp32CredentialStore : public WiFiProvisionerPlatform::CredentialStore {
+public:
+  bool load(Credentials &credentials) override {
+    Record record;
+    Preferences preferences;
+    if (!preferences.begin(PREFERENCES_NAMESPACE, true)) {
+      return false;
+    }
+    size_t length = preferences.getBytes(CREDENTIALS_KEY, &record,
+                                         sizeof(record));
+    preferences.end();
+
+    if (length != sizeof(record) || record.version != CREDENTIALS_VERSION) {
+      return false;
+    }
+    record.credentials.ssid[sizeof(record.credentials.ssid) - 1] = '\0';
+    record.credentials.password[sizeof(record.credentials.password) - 1] =
+        '\0';
+    credentials = record.credentials;
+    return credentials.ssid[0] != '\0';
+  }
+
+  /**
+   * @brief Stores the credentials unless the same ones are stored already,
+   * which saves flash wear on every boot.
+   */
+  bool save(const Credentials &credentials) override {
+    Record record;
+    memset(&record, 0, sizeof(record));
+    record.version = CREDENTIALS_VERSION;
+    record.credentials = credentials;
+
+    Preferences preferences;
+    if (!preferences.begin(PREFERENCES_NAMESPACE, false)) {
+      return false;
+    }
+    Record stored;
+    bool unchanged =
+        preferences.getBytes(CREDENTIALS_KEY, &stored, sizeof(stored)) ==
+            sizeof(stored) &&
+        memcmp(&stored, &record, sizeof(record)) == 0;
+    bool saved =
+        unchanged || preferences.putBytes(CREDENTIALS_KEY, &record,
+                                          sizeof(record)) == sizeof(record);
+    preferences.end();
+    return saved;
+  }
+
+  void clear() override {
+    Preferences preferences;
+    if (preferences.begin(PREFERENCES_NAMESPACE, false)) {
+      preferences.remove(CREDENTIALS_KEY);
+      preferences.end();
+    }
+  }
+
+private:
+  struct Record {
+    uint8_t version;
+    Credentials credentials;
+  };
+};
+
+/**
+ * @brief HTTP server backed by the ESP32 core's `WebServer`.
+ */
+class Esp32HttpServer : public WiFiProvisionerPlatform::HttpServer {
+public:
+  explicit Esp32HttpServer(uint16_t port) : _server(port) {}
+
+  void on(const char *uri, Method method, Handler handler) override {
+    HTTPMethod httpMethod = method == GET    ? HTTP_GET
+                            : method == POST ? HTTP_POST
+                                             : HTTP_ANY;
+    _server.on(uri, httpMethod, std::move(handler));
+  }
+
+  void onNotFound(Handler handler) override {
+    _server.onNotFound(std::move(handler));
+  }
+
+  void collectHeaders(const char *names[], size_t count) override {
+    _server.collectHeaders(names, count);
+  }
+
+  bool begin() override {
+    _server.begin();
+    return true;
+  }
+
+  void stop() override { _server.stop(); }
+
+  void handleClient() override { _server.handleClient(); }
+
+  bool hasArg(const char *name) override { return _server.hasArg(name); }
+
+  const char *arg(const char *name) override {
+    _value = _server.arg(name);
+    return _value.c_str();
+  }
+
+  const char *header(const char *name) override {
+    _value = _server.header(name);
+    return _value.c_str();
+  }
+
+  const char *uri() override {
+    _value = _server.uri();
+    return _value.c_str();
+  }
+
+  bool clientConnected() override { return _server.client().connected(); }
+
+  size_t write(const uint8_t *data, size_t length) override {
+    return _server.client().write(data, length);
+  }
+
+  void endResponse() override {
+    WiFiClient client = _server.client();
+    client.flush();
+    client.stop();
+  }
+
+private:
+  WebServer _server;
+  String _value;
+};
+
+/**
+ * @brief DNS responder on a `WiFiUDP` socket.
+ *
+ * The core's `DNSServer` does not tell whether it answered anything, and on
+ * newer cores answers from the network task, so the loop could not count DNS
+ * traffic as activity. The queries are read here instead and answered by
+ * `DnsResponder`.
+ */
+class Esp32DnsServer : public WiFiProvisionerPlatform::DnsServer {
+public:
+  bool start(uint16_t port, const IPAddress &ip) override {
+    _ip = ip;
+    return _udp.begin(port);
+  }
+
+  void stop() override { _udp.stop(); }
+
+  /**
+   * @brief Answers one pending query, if any.
+   *
+   * @return `true` if a datagram was received.
+   */
+  bool processNextRequest() override {
+    int length = _udp.parsePacket();
+    if (length <= 0) {
+      return false;
+    }
+
+    uint8_t packet[DnsResponder::MAX_PACKET_SIZE];
+    length = _udp.read(packet, sizeof(packet));
+    size_t responseLength =
+        length > 0 ? DnsResponder::answer(packet, length, sizeof(packet), _ip)
+                   : 0;
+    if (responseLength > 0) {
+      _udp.beginPacket(_udp.remoteIP(), _udp.remotePort());
+      _udp.write(packet, responseLength);
+      _udp.endPacket();
+    }
+    return true;
+  }
+
+private:
+  WiFiUDP _udp;
+  IPAddress _ip;
+};
+
+class Esp32Platform : public WiFiProvisionerPlatform {
+public:
+  Radio &radio() override { return _radio; }
+
+  HttpServer *createHttpServer(uint16_t port) override {
+#if WIFI_PROVISIONER_SOCKET_SERVER
+    return new SocketHttpServer(port);
+#else
+    return new Esp32HttpServer(port);
+#endif
+  }
+
+  DnsServer *createDnsServer() override { return new Esp32DnsServer(); }
+
+  CredentialStore *credentialStore() override { return &_credentialStore; }
+
+  /**
+   * @brief Returns the free byte-addressable heap and its largest free block,
+   * and the stack high-water mark of the calling task, which FreeRTOS on ESP32
+   * reports in bytes.
+   */
+  Memory memory() override {
+    Memory memory;
+    memory.freeHeap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    memory.largestFreeBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    memory.stackHighWaterMark = uxTaskGetStackHighWaterMark(nullptr);
+    return memory;
+  }
+
+private:
+  Esp32Radio _radio;
+  Esp32CredentialStore _credentialStore;
+};
+
+} // namespace
+
+/**
+ * @brief Returns the platform backed by the ESP32 core's `WiFi` and `WiFiUDP`
+ * and by `SocketHttpServer`, or the core's `WebServer` if
+ * `WIFI_PROVISIONER_SOCKET_SERVER` is `0`.
+ */
+WiFiProvisionerPlatform &WiFiProvisionerPlatform::defaultPlatform() {
+  static Esp32Platform platform;
+  return platform;
+}
+
+#endif // ARDUINO_ARCH_ESP32
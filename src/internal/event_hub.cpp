@@ -0,0 +1,118 @@
+#include "event_hub.h"
+#include <Arduino.h>
+#include <string.h>
+
+namespace {
+
+// Streams that have been quiet this long get a comment, which keeps proxies
+// from closing them and lets the server notice clients that have gone away
+const unsigned long HEARTBEAT_INTERVAL = 15000;
+
+void put(ResponseWriter &output, const char *text) {
+  output.write(reinterpret_cast<const uint8_t *>(text), strlen(text));
+}
+
+} // namespace
+
+EventHub::EventHub()
+    : _streams(), _count(0), _sentAt(0), _opened(0), _frames() {}
+
+/**
+ * @brief Forgets all streams, which are closed with the server.
+ */
+void EventHub::reset() {
+  _count = 0;
+  _sentAt = millis();
+}
+
+void EventHub::clearStats() {
+  _opened = 0;
+  _frames = WiFiProvisioner::ResponseStats();
+}
+
+/**
+ * @brief Adds a stream that has been sent its snapshot, closing the oldest
+ * stream if `WIFI_PROVISIONER_MAX_EVENT_STREAMS` are open already.
+ */
+void EventHub::add(HttpServer &server, uint32_t stream) {
+  if (_count == WIFI_PROVISIONER_MAX_EVENT_STREAMS) {
+    server.closeStream(_streams[0]);
+    remove(0);
+  }
+  _streams[_count++] = stream;
+  _opened++;
+}
+
+/**
+ * @brief Sends an event to every stream and drops the streams the server has
+ * closed. Must not be called from a request handler.
+ *
+ * @param server The server holding the streams.
+ * @param event The event type, or `nullptr` for a comment without data.
+ * @param data Writes the event data.
+ */
+void EventHub::publish(HttpServer &server, const char *event,
+                       const DataWriter &data) {
+  for (size_t i = 0; i < _count;) {
+    if (!server.resumeStream(_streams[i])) {
+      remove(i);
+      continue;
+    }
+    ResponseWriter output(server, _frames);
+    write(output, event, data);
+    output.end();
+    ++i;
+  }
+  _sentAt = millis();
+}
+
+/**
+ * @brief Sends a comment to the streams if no event has been sent for a
+ * while.
+ */
+void EventHub::heartbeat(HttpServer &server) {
+  if (_count > 0 && millis() - _sentAt >= HEARTBEAT_INTERVAL) {
+    publish(server, nullptr, DataWriter());
+  }
+}
+
+size_t EventHub::count() const { return _count; }
+
+/**
+ * @brief Returns the streams and the events sent to them. Every event counts
+ * once per stream it was sent to.
+ */
+WiFiProvisioner::EventStats EventHub::stats() const {
+  WiFiProvisioner::EventStats stats;
+  stats.streams = _count;
+  stats.opened = _opened;
+  stats.events = _frames.responses;
+  stats.bytes = _frames.bytes;
+  return stats;
+}
+
+/**
+ * @brief Writes an event in the `text/event-stream` format.
+ *
+ * @param output The writer of the stream.
+ * @param event The event type, or `nullptr` for a comment without data.
+ * @param data Writes the event data.
+ */
+void EventHub::write(ResponseWriter &output, const char *event,
+                     const DataWriter &data) {
+  if (event == nullptr) {
+    put(output, ":\n\n");
+    return;
+  }
+  put(output, "event: ");
+  put(output, event);
+  put(output, "\ndata: ");
+  data(output);
+  put(output, "\n\n");
+}
+
+void EventHub::remove(size_t index) {
+  memmove(_streams + index, _streams + index + 1,
+          (_count - index - 1) * sizeof(_streams[0]));
+  _count--;
+}
@@ -0,0 +1,65 @@
+#ifndef EVENT_HUB_H
+#define EVENT_HUB_H
+
+#include "../WiFiProvisioner.h"
+#include "../WiFiProvisionerPlatform.h"
+#include "response_writer.h"
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef WIFI_PROVISIONER_MAX_EVENT_STREAMS
+#define WIFI_PROVISIONER_MAX_EVENT_STREAMS 2 // Open `/events` streams
+#endif
+
+#ifndef WIFI_PROVISIONER_EVENT_QUEUE_SIZE
+#define WIFI_PROVISIONER_EVENT_QUEUE_SIZE 4096 // Unsent bytes per stream
+#endif
+
+/**
+ * @brief Sends server-sent events to the open `/events` streams.
+ *
+ * Each event is written to every stream through a `ResponseWriter`, so it is
+ * formatted straight into the stream's buffer and sent in as few segments as
+ * possible. The server queues what a socket does not take at once, up to
+ * `WIFI_PROVISIONER_EVENT_QUEUE_SIZE` bytes per stream, and closes a stream
+ * that falls further behind instead of queueing more. A slow client thus
+ * costs at most its queue and never holds up the loop; its `EventSource`
+ * reconnects and starts over from a new snapshot.
+ *
+ * At most `WIFI_PROVISIONER_MAX_EVENT_STREAMS` streams are kept. A new stream
+ * replaces the oldest one, which is usually a page the phone has left.
+ */
+class EventHub {
+public:
+  using HttpServer = WiFiProvisionerPlatform::HttpServer;
+  // Writes the data of an event, which must not contain line breaks
+  using DataWriter = std::function<void(ResponseWriter &)>;
+
+  EventHub();
+
+  void reset();
+  void clearStats();
+  void add(HttpServer &server, uint32_t stream);
+  void publish(HttpServer &server, const char *event, const DataWriter &data);
+  void heartbeat(HttpServer &server);
+  size_t count() const;
+  WiFiProvisioner::EventStats stats() const;
+
+  static void write(ResponseWriter &output, const char *event,
+                    const DataWriter &data);
+
+private:
+  EventHub(const EventHub &) = delete;
+  EventHub &operator=(const EventHub &) = delete;
+
+  void remove(size_t index);
+
+  uint32_t _streams[WIFI_PROVISIONER_MAX_EVENT_STREAMS]; // Oldest first
+  size_t _count;
+  unsigned long _sentAt;
+  uint32_t _opened;
+  WiFiProvisioner::ResponseStats _frames;
+};
+
+#endif // EVENT_HUB_H
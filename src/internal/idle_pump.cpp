@@ -0,0 +1,79 @@
+#include "idle_pump.h"
+#include <Arduino.h>
+
+IdlePump::IdlePump()
+    : _shortSleepAfter(50), _longSleepAfter(1000), _longSleep(20),
+      _lastActivity(0), _busyMicros(0), _idleMicros(0), _iterations(0),
+      _sleeps(0) {}
+
+/**
+ * @brief Sets the idle thresholds of the back-off.
+ *
+ * @param shortSleepAfter Idle time in milliseconds after which the loop sleeps
+ * 1 ms per iteration instead of yielding.
+ * @param longSleepAfter Idle time in milliseconds after which the loop sleeps
+ * `longSleep` milliseconds per iteration.
+ * @param longSleep The long sleep in milliseconds.
+ */
+void IdlePump::configure(unsigned long shortSleepAfter,
+                         unsigned long longSleepAfter,
+                         unsigned long longSleep) {
+  _shortSleepAfter = shortSleepAfter;
+  _longSleepAfter = longSleepAfter;
+  _longSleep = longSleep;
+}
+
+/**
+ * @brief Clears the statistics and treats the loop as active.
+ */
+void IdlePump::reset() {
+  _lastActivity = millis();
+  std::lock_guard<std::mutex> guard(_mutex);
+  _busyMicros = 0;
+  _idleMicros = 0;
+  _iterations = 0;
+  _sleeps = 0;
+}
+
+/**
+ * @brief Waits between two loop iterations.
+ *
+ * @param active Whether the iteration that just ran saw any traffic.
+ * @param busyMicros How long the iteration took in microseconds.
+ */
+void IdlePump::wait(bool active, unsigned long busyMicros) {
+  unsigned long now = millis();
+  if (active) {
+    _lastActivity = now;
+  }
+
+  unsigned long idleFor = now - _lastActivity;
+  unsigned long start = micros();
+  bool slept = idleFor >= _shortSleepAfter;
+  if (!slept) {
+    yield();
+  } else {
+    delay(idleFor < _longSleepAfter ? 1 : _longSleep);
+  }
+  unsigned long idleMicros = micros() - start;
+
+  std::lock_guard<std::mutex> guard(_mutex);
+  _busyMicros += busyMicros;
+  _idleMicros += idleMicros;
+  _iterations++;
+  if (slept) {
+    _sleeps++;
+  }
+}
+
+WiFiProvisioner::PumpStats IdlePump::stats() const {
+  std::lock_guard<std::mutex> guard(_mutex);
+  WiFiProvisioner::PumpStats stats;
+  stats.busyMicros = _busyMicros;
+  stats.idleMicros = _idleMicros;
+  stats.iterations = _iterations;
+  stats.sleeps = _sleeps;
+  uint64_t total = _busyMicros + _idleMicros;
+  stats.dutyCycle = total ? static_cast<float>(_busyMicros) / total : 0.0f;
+  return stats;
+}
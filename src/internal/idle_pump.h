@@ -0,0 +1,43 @@
+#ifndef IDLE_PUMP_H
+#define IDLE_PUMP_H
+
+#include "../WiFiProvisioner.h"
+#include <mutex>
+#include <stdint.h>
+
+/**
+ * @brief Paces the provisioning loop according to recent traffic.
+ *
+ * While requests keep arriving the loop only yields between iterations. Once
+ * no traffic has been seen for `shortSleepAfter` milliseconds it sleeps for
+ * 1 ms per iteration, and after `longSleepAfter` milliseconds for
+ * `longSleep` milliseconds, which lets the idle task run and the CPU enter
+ * light sleep. Any traffic returns the loop to yielding at once. The time
+ * spent working and waiting is accumulated to report the duty cycle. The
+ * statistics are updated under a lock, so `stats()` may be called from
+ * another task while the loop runs.
+ */
+class IdlePump {
+public:
+  IdlePump();
+
+  void configure(unsigned long shortSleepAfter, unsigned long longSleepAfter,
+                 unsigned long longSleep);
+  void reset();
+  void wait(bool active, unsigned long busyMicros);
+
+  WiFiProvisioner::PumpStats stats() const;
+
+private:
+  unsigned long _shortSleepAfter;
+  unsigned long _longSleepAfter;
+  unsigned long _longSleep;
+  unsigned long _lastActivity;
+  mutable std::mutex _mutex; // Guards the statistics
+  uint64_t _busyMicros;
+  uint64_t _idleMicros;
+  uint32_t _iterations;
+  uint32_t _sleeps;
+};
+
+#endif // IDLE_PUMP_H
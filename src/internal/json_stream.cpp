@@ -0,0 +1,206 @@
+#include "json_stream.h"
+#include <stdio.h>
+
+JsonStream::JsonStream(ResponseWriter &output)
+    : _output(output), _depth(0), _first(), _afterKey(false) {}
+
+JsonStream &JsonStream::beginObject() {
+  open('{');
+  return *this;
+}
+
+JsonStream &JsonStream::endObject() {
+  close('}');
+  return *this;
+}
+
+JsonStream &JsonStream::beginArray() {
+  open('[');
+  return *this;
+}
+
+JsonStream &JsonStream::endArray() {
+  close(']');
+  return *this;
+}
+
+/**
+ * @brief Writes the name of the next object member.
+ */
+JsonStream &JsonStream::key(const char *name) {
+  separate();
+  putString(name);
+  put(':');
+  _afterKey = true;
+  return *this;
+}
+
+/**
+ * @brief Writes a string value, or `null` for `nullptr`.
+ */
+JsonStream &JsonStream::value(const char *text) {
+  separate();
+  if (text == nullptr) {
+    put("null", 4);
+  } else {
+    putString(text);
+  }
+  return *this;
+}
+
+JsonStream &JsonStream::value(int number) {
+  separate();
+  putSigned(number);
+  return *this;
+}
+
+JsonStream &JsonStream::value(unsigned number) {
+  separate();
+  putUnsigned(number);
+  return *this;
+}
+
+JsonStream &JsonStream::value(long number) {
+  separate();
+  putSigned(number);
+  return *this;
+}
+
+JsonStream &JsonStream::value(unsigned long number) {
+  separate();
+  putUnsigned(number);
+  return *this;
+}
+
+JsonStream &JsonStream::value(long long number) {
+  separate();
+  putSigned(number);
+  return *this;
+}
+
+JsonStream &JsonStream::value(unsigned long long number) {
+  separate();
+  putUnsigned(number);
+  return *this;
+}
+
+JsonStream &JsonStream::value(bool flag) {
+  separate();
+  if (flag) {
+    put("true", 4);
+  } else {
+    put("false", 5);
+  }
+  return *this;
+}
+
+/**
+ * @brief Writes the comma in front of a value or member unless it is the
+ * first one of its container or follows its key.
+ */
+void JsonStream::separate() {
+  if (_afterKey) {
+    _afterKey = false;
+    return;
+  }
+  if (_depth > 0 && _depth <= MAX_DEPTH) {
+    if (!_first[_depth - 1]) {
+      put(',');
+    }
+    _first[_depth - 1] = false;
+  }
+}
+
+void JsonStream::open(char bracket) {
+  separate();
+  put(bracket);
+  if (_depth < MAX_DEPTH) {
+    _first[_depth] = true;
+  }
+  _depth++;
+}
+
+void JsonStream::close(char bracket) {
+  if (_depth > 0) {
+    _depth--;
+  }
+  put(bracket);
+}
+
+void JsonStream::put(char c) { _output.write(static_cast<uint8_t>(c)); }
+
+void JsonStream::put(const char *text, size_t length) {
+  _output.write(reinterpret_cast<const uint8_t *>(text), length);
+}
+
+/**
+ * @brief Writes a quoted string, escaping quotes, backslashes and control
+ * characters like ArduinoJson does. Other bytes are copied unchanged.
+ */
+void JsonStream::putString(const char *text) {
+  put('"');
+  const char *run = text;
+  for (; *text; ++text) {
+    unsigned char c = static_cast<unsigned char>(*text);
+    if (c >= 0x20 && c != '"' && c != '\\') {
+      continue;
+    }
+
+    put(run, text - run);
+    run = text + 1;
+
+    char escape[7] = {'\\', 0};
+    size_t length = 2;
+    switch (c) {
+    case '"':
+    case '\\':
+      escape[1] = c;
+      break;
+    case '\b':
+      escape[1] = 'b';
+      break;
+    case '\f':
+      escape[1] = 'f';
+      break;
+    case '\n':
+      escape[1] = 'n';
+      break;
+    case '\r':
+      escape[1] = 'r';
+      break;
+    case '\t':
+      escape[1] = 't';
+      break;
+    default:
+      snprintf(escape, sizeof(escape), "\\u%04x", c);
+      length = 6;
+      break;
+    }
+    put(escape, length);
+  }
+  put(run, text - run);
+  put('"');
+}
+
+void JsonStream::putSigned(long long number) {
+  if (number < 0) {
+    put('-');
+    putUnsigned(0ULL - static_cast<unsigned long long>(number));
+  } else {
+    putUnsigned(number);
+  }
+}
+
+/**
+ * @brief Formats a number by hand, as newlib's `snprintf()` may be built
+ * without 64-bit support.
+ */
+void JsonStream::putUnsigned(unsigned long long number) {
+  char text[20];
+  size_t start = sizeof(text);
+  do {
+    text[--start] = '0' + number % 10;
+    number /= 10;
+  } while (number > 0);
+  put(text + start, sizeof(text) - start);
+}
@@ -0,0 +1,54 @@
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include "response_writer.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Writes JSON straight into a response body.
+ *
+ * Values are formatted in place and handed to a `ResponseWriter`, which
+ * collects them into segments. Nothing is allocated, however long the document.
+ * Commas between members and elements are inserted automatically.
+ */
+class JsonStream {
+public:
+  static constexpr size_t MAX_DEPTH = 8;
+
+  explicit JsonStream(ResponseWriter &output);
+
+  JsonStream &beginObject();
+  JsonStream &endObject();
+  JsonStream &beginArray();
+  JsonStream &endArray();
+  JsonStream &key(const char *name);
+  JsonStream &value(const char *text);
+  JsonStream &value(int number);
+  JsonStream &value(unsigned number);
+  JsonStream &value(long number);
+  JsonStream &value(unsigned long number);
+  JsonStream &value(long long number);
+  JsonStream &value(unsigned long long number);
+  JsonStream &value(bool flag);
+
+private:
+  JsonStream(const JsonStream &) = delete;
+  JsonStream &operator=(const JsonStream &) = delete;
+
+  void separate();
+  void open(char bracket);
+  void close(char bracket);
+  void put(char c);
+  void put(const char *text, size_t length);
+  void putString(const char *text);
+  void putSigned(long long number);
+  void putUnsigned(unsigned long long number);
+
+  ResponseWriter &_output;
+  uint8_t _depth;
+  bool _first[MAX_DEPTH]; // Whether the container at each depth is empty
+  bool _afterKey;
+};
+
+#endif // JSON_STREAM_H
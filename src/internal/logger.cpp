@@ -0,0 +1,245 @@
+#include "logger.h"
+#include <Arduino.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+#if WIFI_PROVISIONER_LOG_LEVEL < WIFI_PROVISIONER_LOG_NONE
+
+namespace {
+
+const char *levelName(int level) {
+  switch (level) {
+  case WIFI_PROVISIONER_LOG_DEBUG:
+    return "DEBUG";
+  case WIFI_PROVISIONER_LOG_INFO:
+    return "INFO";
+  case WIFI_PROVISIONER_LOG_WARN:
+    return "WARN";
+  default:
+    return "ERROR";
+  }
+}
+
+/**
+ * @brief Appends formatted text to a line, truncating it at its end.
+ */
+void append(char *line, size_t size, size_t &length, const char *format,
+            ...) {
+  if (length + 1 >= size) {
+    return;
+  }
+  va_list args;
+  va_start(args, format);
+  int written = vsnprintf(line + length, size - length, format, args);
+  va_end(args);
+  if (written > 0) {
+    length += static_cast<size_t>(written) < size - length ? written
+                                                          : size - length - 1;
+  }
+}
+
+} // namespace
+
+Logger::Slot Logger::_slots[CAPACITY];
+uint32_t Logger::_reportedDrops = 0;
+std::atomic<bool> Logger::_draining(false);
+
+/**
+ * @brief Formats up to `maxEntries` queued entries in the order they were
+ * logged and passes each to `sink`, or prints it to `Serial` if `sink` is
+ * empty. Entries dropped since the last drain are reported as a warning.
+ *
+ * @return The number of entries drained, `0` if another task is draining.
+ */
+size_t Logger::drain(const WiFiProvisioner::LogCallback &sink,
+                     size_t maxEntries) {
+  if (_draining.exchange(true, std::memory_order_acquire)) {
+    return 0;
+  }
+
+  size_t drained = 0;
+  while (drained < maxEntries) {
+    Slot &slot = _slots[_tail % CAPACITY];
+    uint32_t index = _tail % CAPACITY;
+    if (slot.sequence.load(std::memory_order_acquire) != _tail - index + 1) {
+      break;
+    }
+
+    char line[LINE_SIZE];
+    format(slot.entry, line, sizeof(line));
+    int level = slot.entry.level;
+    // Free the entry before the slow output
+    slot.sequence.store(_tail + CAPACITY - index, std::memory_order_release);
+    _tail++;
+    drained++;
+
+    if (sink) {
+      sink(level, line);
+    } else {
+      Serial.printf("[%s] %s\n", levelName(level), line);
+    }
+  }
+
+  uint32_t dropped = _dropped.load(std::memory_order_relaxed);
+  if (dropped != _reportedDrops) {
+    char line[48];
+    snprintf(line, sizeof(line), "%u log messages dropped",
+             static_cast<unsigned>(dropped - _reportedDrops));
+    _reportedDrops = dropped;
+    if (sink) {
+      sink(WIFI_PROVISIONER_LOG_WARN, line);
+    } else {
+      Serial.printf("[%s] %s\n", levelName(WIFI_PROVISIONER_LOG_WARN), line);
+    }
+  }
+
+  _draining.store(false, std::memory_order_release);
+  return drained;
+}
+
+/**
+ * @brief Claims the next free entry.
+ *
+ * @param position Receives the position to pass to `commit()`.
+ *
+ * @return The entry, or `nullptr` if the buffer is full.
+ */
+Logger::Entry *Logger::reserve(uint32_t &position) {
+  position = _head.load(std::memory_order_relaxed);
+  for (;;) {
+    uint32_t index = position % CAPACITY;
+    Slot &slot = _slots[index];
+    int32_t state = static_cast<int32_t>(
+        slot.sequence.load(std::memory_order_acquire) - (position - index));
+    if (state == 0) {
+      if (_head.compare_exchange_weak(position, position + 1,
+                                      std::memory_order_relaxed)) {
+        return &slot.entry;
+      }
+    } else if (state < 0) {
+      _dropped.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    } else {
+      position = _head.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+/**
+ * @brief Hands a filled entry to the drain.
+ */
+void Logger::commit(uint32_t position) {
+  uint32_t index = position % CAPACITY;
+  _slots[index].sequence.store(position - index + 1,
+                               std::memory_order_release);
+}
+
+void Logger::encode(Entry &entry, const char *value) {
+  if (value == nullptr) {
+    value = "(null)";
+  }
+  // The last byte stays free so that strings which no longer fit read as ""
+  size_t offset = entry.textLength;
+  size_t length = strnlen(value, TEXT_SIZE - 1 - offset);
+  memcpy(entry.text + offset, value, length);
+  entry.text[offset + length] = '\0';
+  entry.types[entry.argCount] = TEXT;
+  entry.values[entry.argCount++].text = offset;
+  entry.textLength =
+      offset + length + 1 < TEXT_SIZE ? offset + length + 1 : TEXT_SIZE - 1;
+}
+
+/**
+ * @brief Formats an entry by rebuilding each conversion of its format for
+ * the stored argument.
+ *
+ * @return The length of the formatted line.
+ */
+size_t Logger::format(const Entry &entry, char *line, size_t size) {
+  size_t length = 0;
+  size_t arg = 0;
+  line[0] = '\0';
+
+  const char *run = entry.format;
+  for (const char *p = entry.format; *p;) {
+    if (*p != '%') {
+      ++p;
+      continue;
+    }
+    append(line, size, length, "%.*s", static_cast<int>(p - run), run);
+
+    // Flags, width and precision are copied, length modifiers dropped
+    char spec[16] = "%";
+    size_t specLength = 1;
+    for (++p; *p && strchr("-+ #0123456789.", *p); ++p) {
+      if (specLength < sizeof(spec) - 4) {
+        spec[specLength++] = *p;
+      }
+    }
+    while (*p && strchr("hljztL", *p)) {
+      ++p;
+    }
+    char conversion = *p;
+    if (conversion == '\0') {
+      run = p;
+      break;
+    }
+    run = ++p;
+
+    if (conversion == '%') {
+      append(line, size, length, "%%");
+      continue;
+    }
+    if (arg >= entry.argCount) {
+      continue;
+    }
+    Type type = entry.types[arg];
+    const auto &value = entry.values[arg++];
+
+    if (type == INTEGER && strchr("di", conversion)) {
+      memcpy(spec + specLength, "lld", 4);
+      append(line, size, length, spec, value.integer);
+    } else if (type == INTEGER && strchr("uxXo", conversion)) {
+      spec[specLength++] = 'l';
+      spec[specLength++] = 'l';
+      spec[specLength] = conversion;
+      append(line, size, length, spec,
+             static_cast<unsigned long long>(value.integer));
+    } else if (type == INTEGER && conversion == 'c') {
+      spec[specLength] = 'c';
+      append(line, size, length, spec, static_cast<int>(value.integer));
+    } else if (type == REAL && strchr("feEgG", conversion)) {
+      spec[specLength] = conversion;
+      append(line, size, length, spec, value.real);
+    } else if (type == TEXT && conversion == 's') {
+      spec[specLength] = 's';
+      append(line, size, length, spec, entry.text + value.text);
+    } else {
+      append(line, size, length, "?");
+    }
+  }
+  append(line, size, length, "%s", run);
+  return length;
+}
+
+#endif // WIFI_PROVISIONER_LOG_LEVEL < WIFI_PROVISIONER_LOG_NONE
+
+// Also built without logging, where nothing is claimed and these stay 0
+std::atomic<uint32_t> Logger::_head(0);
+uint32_t Logger::_tail = 0;
+std::atomic<uint32_t> Logger::_dropped(0);
+
+/**
+ * @brief Returns the number of entries claimed but not drained yet. Only
+ * exact when called from the task that drains.
+ */
+size_t Logger::pending() {
+  return _head.load(std::memory_order_relaxed) - _tail;
+}
+
+/**
+ * @brief Returns the number of entries dropped because the buffer was full.
+ */
+uint32_t Logger::dropped() {
+  return _dropped.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,149 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include "../WiFiProvisioner.h"
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+// Entries held until drained, about 100 bytes each. The provisioning loop
+// drains the buffer while idle, and down to a quarter while busy whenever it
+// is half full. Entries logged while it is full are dropped, and the number
+// dropped is logged once it drains.
+#ifndef WIFI_PROVISIONER_LOG_BUFFER_SIZE
+#define WIFI_PROVISIONER_LOG_BUFFER_SIZE 32
+#endif
+
+/**
+ * @brief Logs a message if `level` is at least `WIFI_PROVISIONER_LOG_LEVEL`.
+ *
+ * The level is compared at compile time, so messages below the minimum level
+ * leave no code, strings or argument evaluation behind. The format is checked
+ * like `printf()`'s, but only formatted when the entry is drained. With
+ * `WIFI_PROVISIONER_LOG_NONE` the ring buffer is not built either.
+ */
+#if WIFI_PROVISIONER_LOG_LEVEL < WIFI_PROVISIONER_LOG_NONE
+#define WIFI_PROVISIONER_DEBUG_LOG(level, format, ...)                         \
+  do {                                                                         \
+    if (level >= WIFI_PROVISIONER_LOG_LEVEL) {                                 \
+      if (false) {                                                             \
+        Logger::checkFormat(format, ##__VA_ARGS__);                            \
+      }                                                                        \
+      Logger::log(level, format, ##__VA_ARGS__);                               \
+    }                                                                          \
+  } while (0)
+#else
+#define WIFI_PROVISIONER_DEBUG_LOG(level, format, ...)                         \
+  do {                                                                         \
+    if (false) {                                                               \
+      Logger::checkFormat(format, ##__VA_ARGS__);                              \
+    }                                                                          \
+  } while (0)
+#endif
+
+/**
+ * @brief Queues log entries in a fixed ring buffer and formats them later.
+ *
+ * `log()` only copies the format pointer and the arguments into the next free
+ * entry, including up to `TEXT_SIZE` bytes of string arguments, and never
+ * blocks or allocates. Entries logged while the buffer is full are dropped
+ * and counted. `drain()` formats the queued entries and hands them to a sink,
+ * so the slow output to the UART happens when the caller chooses. Any task
+ * may log; entries are claimed with atomics, so logging also works from
+ * several cores at once. Draining from several tasks is safe, as only one of
+ * them drains at a time.
+ *
+ * Formats must be string literals. The conversions `d i u x X o c s f e E g G`
+ * with flags, width and precision are supported; length modifiers are
+ * accepted and ignored, as the arguments keep their own width.
+ */
+class Logger {
+public:
+  static constexpr size_t CAPACITY = WIFI_PROVISIONER_LOG_BUFFER_SIZE;
+  static constexpr size_t MAX_ARGS = 4;   // Arguments per entry
+  static constexpr size_t TEXT_SIZE = 48; // String argument bytes per entry
+  static constexpr size_t LINE_SIZE = 160;
+
+  static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0,
+                "WIFI_PROVISIONER_LOG_BUFFER_SIZE must be a power of two");
+
+  template <typename... Args>
+  static void log(int level, const char *format, Args... args) {
+    static_assert(sizeof...(Args) <= MAX_ARGS, "Too many log arguments");
+    uint32_t position;
+    Entry *entry = reserve(position);
+    if (entry == nullptr) {
+      return;
+    }
+    entry->format = format;
+    entry->level = level;
+    entry->argCount = 0;
+    entry->textLength = 0;
+    int expand[] = {0, (encode(*entry, args), 0)...};
+    (void)expand;
+    commit(position);
+  }
+
+  // Never called, only lets the compiler check the format and arguments
+  __attribute__((format(printf, 1, 2))) static void
+  checkFormat(const char *format, ...) {}
+
+  static size_t drain(const WiFiProvisioner::LogCallback &sink,
+                      size_t maxEntries);
+  static size_t pending();
+  static uint32_t dropped();
+
+private:
+  enum Type : uint8_t { INTEGER, REAL, TEXT };
+
+  struct Entry {
+    const char *format;
+    uint8_t level;
+    uint8_t argCount;
+    uint8_t textLength;
+    Type types[MAX_ARGS];
+    union {
+      long long integer; // Unsigned values are stored bit for bit
+      double real;
+      uint8_t text; // Offset into `text`
+    } values[MAX_ARGS];
+    char text[TEXT_SIZE];
+  };
+
+  struct Slot {
+    // Position of the entry minus the slot index, plus 1 once committed
+    std::atomic<uint32_t> sequence;
+    Entry entry;
+  };
+
+  static Entry *reserve(uint32_t &position);
+  static void commit(uint32_t position);
+  static size_t format(const Entry &entry, char *line, size_t size);
+
+  template <typename T>
+  static typename std::enable_if<std::is_integral<T>::value>::type
+  encode(Entry &entry, T value) {
+    entry.types[entry.argCount] = INTEGER;
+    entry.values[entry.argCount++].integer = static_cast<long long>(value);
+  }
+
+  template <typename T>
+  static typename std::enable_if<std::is_floating_point<T>::value>::type
+  encode(Entry &entry, T value) {
+    entry.types[entry.argCount] = REAL;
+    entry.values[entry.argCount++].real = value;
+  }
+
+  static void encode(Entry &entry, const char *value);
+
+  static Slot _slots[CAPACITY];
+  static std::atomic<uint32_t> _head; // Next position to log to
+  static uint32_t _tail;              // Next position to drain
+  static std::atomic<uint32_t> _dropped;
+  static uint32_t _reportedDrops; // Drops already reported by `drain()`
+  static std::atomic<bool> _draining;
+};
+
+#endif // LOGGER_H
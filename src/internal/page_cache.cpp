@@ -0,0 +1,423 @@
+#include "page_cache.h"
+#include "provision_html.h"
+#include "provision_html_gz.h"
+#include <stdlib.h>
+
+namespace {
+
+// FNV-1a over `length` bytes, split in halves to keep the constexpr recursion
+// shallow enough for the compilers' default depth limit
+constexpr uint32_t fnv1a(const char *data, size_t length, uint32_t hash) {
+  return length == 0
+             ? hash
+             : length == 1
+                   ? (hash ^ static_cast<uint8_t>(data[0])) * 0x01000193
+                   : fnv1a(data + length / 2, length - length / 2,
+                           fnv1a(data, length / 2, hash));
+}
+
+struct StaticFragment {
+  const char *data;
+  size_t length;
+};
+
+constexpr StaticFragment staticFragments[] = {
+    {index_html1, sizeof(index_html1) - 1},
+    {index_html2, sizeof(index_html2) - 1},
+    {index_html3, sizeof(index_html3) - 1},
+    {index_html4, sizeof(index_html4) - 1},
+    {index_html5, sizeof(index_html5) - 1},
+    {index_html6, sizeof(index_html6) - 1},
+    {index_html7, sizeof(index_html7) - 1},
+    {index_html8, sizeof(index_html8) - 1},
+    {index_html9, sizeof(index_html9) - 1},
+    {index_html10, sizeof(index_html10) - 1},
+    {index_html11, sizeof(index_html11) - 1},
+    {index_html12, sizeof(index_html12) - 1},
+    {index_html13, sizeof(index_html13) - 1},
+};
+
+constexpr uint32_t staticHash(size_t index = 0, uint32_t hash = 0x811c9dc5) {
+  return index == sizeof(staticFragments) / sizeof(staticFragments[0])
+             ? hash
+             : staticHash(index + 1,
+                          fnv1a(staticFragments[index].data,
+                                staticFragments[index].length, hash));
+}
+
+} // namespace
+
+// provision_html_gz.h must be regenerated whenever provision_html.h changes
+static_assert(staticHash() == index_html_hash,
+              "provision_html_gz.h is out of date, run "
+              "extras/generate_gzip_html.py");
+
+namespace {
+
+struct GzipFragment {
+  const uint8_t *data;
+  size_t length;
+};
+
+const GzipFragment gzipFragments[] = {
+    {index_html1_gz, sizeof(index_html1_gz)},
+    {index_html2_gz, sizeof(index_html2_gz)},
+    {index_html3_gz, sizeof(index_html3_gz)},
+    {index_html4_gz, sizeof(index_html4_gz)},
+    {index_html5_gz, sizeof(index_html5_gz)},
+    {index_html6_gz, sizeof(index_html6_gz)},
+    {index_html7_gz, sizeof(index_html7_gz)},
+    {index_html8_gz, sizeof(index_html8_gz)},
+    {index_html9_gz, sizeof(index_html9_gz)},
+    {index_html10_gz, sizeof(index_html10_gz)},
+    {index_html11_gz, sizeof(index_html11_gz)},
+    {index_html12_gz, sizeof(index_html12_gz)},
+    {index_html13_gz, sizeof(index_html13_gz)},
+};
+
+const uint8_t gzipHeader[10] = {0x1f, 0x8b, 0x08, 0x00, 0x00,
+                                0x00, 0x00, 0x00, 0x00, 0x03};
+
+// Empty final stored block closing the deflate stream
+const uint8_t deflateEnd[5] = {0x01, 0x00, 0x00, 0xff, 0xff};
+
+const size_t STORED_BLOCK_MAX = 0xffff;
+const size_t STORED_BLOCK_HEADER = 5;
+
+uint32_t crc32Update(uint32_t crc, const char *data, size_t length,
+                     bool progmem) {
+  crc = ~crc;
+  for (size_t i = 0; i < length; ++i) {
+    crc ^= progmem ? pgm_read_byte(data + i) : static_cast<uint8_t>(data[i]);
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+uint32_t fnv1aUpdate(uint32_t hash, const char *data, size_t length) {
+  for (size_t i = 0; i < length; ++i) {
+    hash = (hash ^ static_cast<uint8_t>(data[i])) * 0x01000193;
+  }
+  return hash;
+}
+
+uint32_t
+configHash(const PageCache::Fragment (&parts)[PageCache::FRAGMENT_COUNT]) {
+  uint32_t hash = 0x811c9dc5;
+  for (size_t i = 1; i < PageCache::FRAGMENT_COUNT; i += 2) {
+    // Hash the terminator too so that moving text between fields counts
+    hash = fnv1aUpdate(hash, parts[i].data, parts[i].length + 1);
+  }
+  return hash;
+}
+
+size_t storedLength(size_t length) {
+  size_t blocks = (length + STORED_BLOCK_MAX - 1) / STORED_BLOCK_MAX;
+  return length + blocks * STORED_BLOCK_HEADER;
+}
+
+uint8_t *writeStored(uint8_t *cursor, const char *data, size_t length) {
+  while (length > 0) {
+    size_t chunk = length < STORED_BLOCK_MAX ? length : STORED_BLOCK_MAX;
+    // Non-final stored block: BFINAL=0, BTYPE=00, then LEN and NLEN
+    *cursor++ = 0x00;
+    *cursor++ = chunk & 0xff;
+    *cursor++ = (chunk >> 8) & 0xff;
+    *cursor++ = ~chunk & 0xff;
+    *cursor++ = (~chunk >> 8) & 0xff;
+    memcpy(cursor, data, chunk);
+    cursor += chunk;
+    data += chunk;
+    length -= chunk;
+  }
+  return cursor;
+}
+
+uint8_t *writeLittleEndian32(uint8_t *cursor, uint32_t value) {
+  for (int i = 0; i < 4; ++i) {
+    *cursor++ = (value >> (8 * i)) & 0xff;
+  }
+  return cursor;
+}
+
+} // namespace
+
+PageCache::PageCache()
+    : _buffer(nullptr), _size(0), _gzipBuffer(nullptr), _gzipSize(0),
+      _configHash(0), _etag(), _gzipEtag(), _etagValid(false), _dirty(true), _hits(0),
+      _misses(0) {}
+
+PageCache::~PageCache() { release(); }
+
+/**
+ * @brief Lists the pieces that make up the provisioning page in order.
+ *
+ * Static fragments live in PROGMEM and alternate with the dynamic `Config`
+ * values. `INPUT_LENGTH` is formatted into the caller-provided buffer, which
+ * must outlive the returned fragment table.
+ *
+ * @param config The configuration providing the dynamic values.
+ * @param inputLength Scratch buffer receiving the formatted `INPUT_LENGTH`.
+ * @param out The fragment table to populate.
+ *
+ * @return The total length of the page in bytes.
+ */
+size_t PageCache::fragments(const WiFiProvisioner::Config &config,
+                            char (&inputLength)[12],
+                            Fragment (&out)[FRAGMENT_COUNT]) {
+  snprintf(inputLength, sizeof(inputLength), "%d", config.INPUT_LENGTH);
+
+  const char *pieces[FRAGMENT_COUNT] = {
+      index_html1,
+      config.HTML_TITLE,
+      index_html2,
+      config.THEME_COLOR,
+      index_html3,
+      config.SVG_LOGO,
+      index_html4,
+      config.PROJECT_TITLE,
+      index_html5,
+      config.PROJECT_SUB_TITLE,
+      index_html6,
+      config.PROJECT_INFO,
+      index_html7,
+      config.INPUT_TEXT,
+      index_html8,
+      inputLength,
+      index_html9,
+      config.CONNECTION_SUCCESSFUL,
+      index_html10,
+      config.FOOTER_TEXT,
+      index_html11,
+      config.RESET_CONFIRMATION_TEXT,
+      index_html12,
+      config.SHOW_RESET_FIELD ? "true" : "false",
+      index_html13,
+  };
+
+  size_t total = 0;
+  for (size_t i = 0; i < FRAGMENT_COUNT; ++i) {
+    // Even entries are PROGMEM fragments, odd entries are RAM strings
+    const char *piece = pieces[i] ? pieces[i] : "";
+    out[i].data = piece;
+    out[i].length = (i % 2 == 0) ? strlen_P(piece) : strlen(piece);
+    total += out[i].length;
+  }
+  return total;
+}
+
+/**
+ * @brief Renders the page into the cache buffer.
+ *
+ * Renders both the plain page and its gzip encoded copy. A failure to build
+ * the gzip copy is not fatal, such requests are then served the plain page.
+ *
+ * @param config The configuration to render the page with.
+ *
+ * @return `true` if the page was rendered, `false` if the buffer could not be
+ * allocated.
+ */
+bool PageCache::render(const WiFiProvisioner::Config &config) {
+  char inputLength[12];
+  Fragment parts[FRAGMENT_COUNT];
+  size_t total = fragments(config, inputLength, parts);
+
+  char *buffer = static_cast<char *>(realloc(_buffer, total));
+  if (buffer == nullptr) {
+    release();
+    return false;
+  }
+
+  char *cursor = buffer;
+  for (size_t i = 0; i < FRAGMENT_COUNT; ++i) {
+    if (i % 2 == 0) {
+      memcpy_P(cursor, parts[i].data, parts[i].length);
+    } else {
+      memcpy(cursor, parts[i].data, parts[i].length);
+    }
+    cursor += parts[i].length;
+  }
+
+  _buffer = buffer;
+  _size = total;
+  _dirty = false;
+  _configHash = configHash(parts);
+  _etagValid = false;
+
+  renderGzip(parts);
+  return true;
+}
+
+/**
+ * @brief Builds the gzip encoded page from the precompressed fragments.
+ *
+ * The static fragments are stored as raw deflate data ending on a byte
+ * boundary, so the `Config` strings can be placed between them as stored
+ * (uncompressed) deflate blocks. The CRC-32 of the gzip trailer is computed
+ * over the plain page.
+ *
+ * @param parts The plain page fragments, as returned by `fragments()`.
+ *
+ * @return `true` if the gzip page was built, `false` if the buffer could not
+ * be allocated.
+ */
+bool PageCache::renderGzip(const Fragment (&parts)[FRAGMENT_COUNT]) {
+  size_t total = sizeof(gzipHeader) + sizeof(deflateEnd) + 8;
+  uint32_t crc = 0;
+  size_t rawLength = 0;
+  for (size_t i = 0; i < FRAGMENT_COUNT; ++i) {
+    if (i % 2 == 0) {
+      total += gzipFragments[i / 2].length;
+    } else {
+      total += storedLength(parts[i].length);
+    }
+    crc = crc32Update(crc, parts[i].data, parts[i].length, i % 2 == 0);
+    rawLength += parts[i].length;
+  }
+
+  uint8_t *buffer = static_cast<uint8_t *>(realloc(_gzipBuffer, total));
+  if (buffer == nullptr) {
+    free(_gzipBuffer);
+    _gzipBuffer = nullptr;
+    _gzipSize = 0;
+    return false;
+  }
+
+  uint8_t *cursor = buffer;
+  memcpy(cursor, gzipHeader, sizeof(gzipHeader));
+  cursor += sizeof(gzipHeader);
+  for (size_t i = 0; i < FRAGMENT_COUNT; ++i) {
+    if (i % 2 == 0) {
+      const GzipFragment &fragment = gzipFragments[i / 2];
+      memcpy_P(cursor, fragment.data, fragment.length);
+      cursor += fragment.length;
+    } else {
+      cursor = writeStored(cursor, parts[i].data, parts[i].length);
+    }
+  }
+  memcpy(cursor, deflateEnd, sizeof(deflateEnd));
+  cursor += sizeof(deflateEnd);
+  cursor = writeLittleEndian32(cursor, crc);
+  cursor = writeLittleEndian32(cursor, static_cast<uint32_t>(rawLength));
+
+  _gzipBuffer = buffer;
+  _gzipSize = total;
+  return true;
+}
+
+/**
+ * @brief Returns the rendered page, rendering it first if the cache is dirty
+ * or the `Config` strings changed since it was rendered.
+ *
+ * @param config The configuration to render the page with on a miss.
+ * @param length Receives the page length in bytes.
+ * @param gzip Whether the gzip encoded page is accepted. Cleared when only
+ * the plain page is available, so it tells which copy was returned.
+ *
+ * @return A pointer to the rendered page, or `nullptr` if rendering failed.
+ */
+const char *PageCache::acquire(const WiFiProvisioner::Config &config,
+                               size_t &length, bool &gzip) {
+  track(config);
+  if (_dirty || _buffer == nullptr) {
+    _misses++;
+    if (!render(config)) {
+      length = 0;
+      return nullptr;
+    }
+  } else {
+    _hits++;
+  }
+
+  if (gzip && _gzipBuffer != nullptr) {
+    length = _gzipSize;
+    return reinterpret_cast<const char *>(_gzipBuffer);
+  }
+
+  gzip = false;
+  length = _size;
+  return _buffer;
+}
+
+/**
+ * @brief Returns the entity tag of the page rendered with the given
+ * configuration.
+ *
+ * The tag combines `index_html_hash`, generated from the static fragments,
+ * with an FNV-1a hash of the `Config` strings, so it changes whenever either
+ * part of the page does. The plain and gzip encoded pages have distinct tags.
+ * The tag is computed without rendering the page.
+ *
+ * @param config The configuration the page is rendered with.
+ * @param gzip Whether to return the tag of the gzip encoded page.
+ *
+ * @return The quoted entity tag, e.g. `"8d5cab14-1f2e3d4c"`.
+ */
+const char *PageCache::etag(const WiFiProvisioner::Config &config, bool gzip) {
+  track(config);
+  if (!_etagValid) {
+    snprintf(_etag, sizeof(_etag), "\"%08x-%08x\"",
+             static_cast<unsigned>(index_html_hash),
+             static_cast<unsigned>(_configHash));
+    snprintf(_gzipEtag, sizeof(_gzipEtag), "\"%08x-%08x-gz\"",
+             static_cast<unsigned>(index_html_hash),
+             static_cast<unsigned>(_configHash));
+    _etagValid = true;
+  }
+  return gzip ? _gzipEtag : _etag;
+}
+
+/**
+ * @brief Marks the page dirty if the `Config` strings no longer hash to the
+ * value the page was rendered from.
+ *
+ * The configuration is a plain structure that the application may change
+ * through `getConfig()` at any time, so the hash is compared on every page
+ * request instead of relying on the application to report changes.
+ *
+ * @param config The configuration the page is rendered with.
+ */
+void PageCache::track(const WiFiProvisioner::Config &config) {
+  char inputLength[12];
+  Fragment parts[FRAGMENT_COUNT];
+  fragments(config, inputLength, parts);
+
+  uint32_t hash = configHash(parts);
+  if (hash != _configHash) {
+    _configHash = hash;
+    _dirty = true;
+    _etagValid = false;
+  }
+}
+
+void PageCache::invalidate() {
+  _dirty = true;
+  _etagValid = false;
+}
+
+/**
+ * @brief Frees the page buffers. The next `acquire()` renders it again.
+ */
+void PageCache::release() {
+  free(_buffer);
+  _buffer = nullptr;
+  _size = 0;
+  free(_gzipBuffer);
+  _gzipBuffer = nullptr;
+  _gzipSize = 0;
+  _dirty = true;
+  _etagValid = false;
+}
+
+bool PageCache::isDirty() const { return _dirty; }
+
+WiFiProvisioner::PageCacheStats PageCache::stats() const {
+  WiFiProvisioner::PageCacheStats stats;
+  stats.size = _size;
+  stats.gzipSize = _gzipSize;
+  stats.hits = _hits;
+  stats.misses = _misses;
+  return stats;
+}
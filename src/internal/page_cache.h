@@ -0,0 +1,66 @@
+#ifndef PAGE_CACHE_H
+#define PAGE_CACHE_H
+
+#include "../WiFiProvisioner.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Holds the fully rendered provisioning page in one contiguous buffer.
+ *
+ * The page is assembled from the static `index_htmlN` fragments and the
+ * `Config` strings once, and then served with a single write until the cache
+ * is invalidated or the `Config` strings change. Next to the plain page a gzip encoded copy is kept, built
+ * from the precompressed fragments in `provision_html_gz.h`.
+ *
+ * Each copy has an entity tag made of the hash of the static fragments and a
+ * hash of the `Config` strings, so clients can revalidate the page with
+ * `If-None-Match` instead of downloading it again.
+ */
+class PageCache {
+public:
+  static constexpr size_t FRAGMENT_COUNT = 25;
+
+  struct Fragment {
+    const char *data;
+    size_t length;
+  };
+
+  PageCache();
+  ~PageCache();
+
+  const char *acquire(const WiFiProvisioner::Config &config, size_t &length,
+                      bool &gzip);
+  bool render(const WiFiProvisioner::Config &config);
+  const char *etag(const WiFiProvisioner::Config &config, bool gzip = false);
+  void invalidate();
+  void release();
+
+  bool isDirty() const;
+  WiFiProvisioner::PageCacheStats stats() const;
+
+  static size_t fragments(const WiFiProvisioner::Config &config,
+                          char (&inputLength)[12],
+                          Fragment (&out)[FRAGMENT_COUNT]);
+
+private:
+  PageCache(const PageCache &) = delete;
+  PageCache &operator=(const PageCache &) = delete;
+
+  bool renderGzip(const Fragment (&parts)[FRAGMENT_COUNT]);
+  void track(const WiFiProvisioner::Config &config);
+
+  char *_buffer;
+  size_t _size;
+  uint8_t *_gzipBuffer;
+  size_t _gzipSize;
+  uint32_t _configHash;
+  char _etag[24];
+  char _gzipEtag[24];
+  bool _etagValid;
+  bool _dirty;
+  uint32_t _hits;
+  uint32_t _misses;
+};
+
+#endif // PAGE_CACHE_H
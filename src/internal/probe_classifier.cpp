@@ -0,0 +1,81 @@
+#include "probe_classifier.h"
+#include <string.h>
+
+namespace {
+
+struct Signature {
+  const char *text;
+  ProbeClassifier::Os os;
+};
+
+// Paths the connectivity checks request, matched exactly
+const Signature PROBE_PATHS[] = {
+    {"/generate_204", ProbeClassifier::ANDROID},
+    {"/gen_204", ProbeClassifier::ANDROID},
+    {"/hotspot-detect.html", ProbeClassifier::APPLE},
+    {"/library/test/success.html", ProbeClassifier::APPLE},
+    {"/connecttest.txt", ProbeClassifier::WINDOWS},
+    {"/ncsi.txt", ProbeClassifier::WINDOWS},
+    {"/redirect", ProbeClassifier::WINDOWS},
+    {"/fwlink", ProbeClassifier::WINDOWS},
+    {"/success.txt", ProbeClassifier::OTHER},
+    {"/canonical.html", ProbeClassifier::OTHER},
+    {"/static/hotspot.txt", ProbeClassifier::OTHER},
+    {"/check_network_status.txt", ProbeClassifier::OTHER},
+};
+
+// User agents of the connectivity checks, matched anywhere in the header
+const Signature PROBE_AGENTS[] = {
+    {"CaptiveNetworkSupport", ProbeClassifier::APPLE},
+    {"Microsoft NCSI", ProbeClassifier::WINDOWS},
+    {"Dalvik/", ProbeClassifier::ANDROID},
+};
+
+} // namespace
+
+/**
+ * @brief Classifies the current request of a server, which must collect the
+ * `User-Agent` header.
+ *
+ * @return The operating system that sent the probe, or `NONE` for a request
+ * that should get the provisioning page.
+ */
+ProbeClassifier::Os
+ProbeClassifier::classify(WiFiProvisionerPlatform::HttpServer &server) {
+  // Each accessor may overwrite the string the previous one returned
+  const char *path = server.uri();
+  for (const Signature &signature : PROBE_PATHS) {
+    if (strcmp(path, signature.text) == 0) {
+      return signature.os;
+    }
+  }
+  const char *userAgent = server.header("User-Agent");
+  for (const Signature &signature : PROBE_AGENTS) {
+    if (strstr(userAgent, signature.text) != nullptr) {
+      return signature.os;
+    }
+  }
+  return NONE;
+}
+
+/**
+ * @brief Counts a probe in the statistics of its operating system.
+ */
+void ProbeClassifier::count(Os os, WiFiProvisioner::ProbeStats &stats) {
+  switch (os) {
+  case ANDROID:
+    stats.android++;
+    break;
+  case APPLE:
+    stats.apple++;
+    break;
+  case WINDOWS:
+    stats.windows++;
+    break;
+  case OTHER:
+    stats.other++;
+    break;
+  case NONE:
+    break;
+  }
+}
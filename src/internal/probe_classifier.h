@@ -0,0 +1,30 @@
+#ifndef PROBE_CLASSIFIER_H
+#define PROBE_CLASSIFIER_H
+
+#include "../WiFiProvisioner.h"
+#include "../WiFiProvisionerPlatform.h"
+
+/**
+ * @brief Tells the connectivity checks operating systems send after joining a
+ * network apart from pages a browser navigates to.
+ *
+ * A request is a probe if its path is one of the well-known check paths, or
+ * if its `User-Agent` is one of the check clients, which only ever probe. The
+ * check paths also cover the URLs a browser opens when the user taps the
+ * captive-portal notification, since those load the probe URL again.
+ */
+class ProbeClassifier {
+public:
+  enum Os {
+    NONE,    // Not a probe
+    ANDROID, // Android and Chrome OS
+    APPLE,   // iOS and macOS
+    WINDOWS, // Windows
+    OTHER,   // Firefox and Linux distributions
+  };
+
+  static Os classify(WiFiProvisionerPlatform::HttpServer &server);
+  static void count(Os os, WiFiProvisioner::ProbeStats &stats);
+};
+
+#endif // PROBE_CLASSIFIER_H
@@ -539,54 +539,17 @@ static constexpr const char index_html3[] PROGMEM = R"rawliteral(;
       const code_listener = document.getElementById("code");
       const ssid_listener = document.getElementById("ssid");
       const password_listener = document.getElementById("password");
+      const rows = new Map();
+      let scanVersion = 0;
+      let events = null;
+      let lastStatus = null;
+      let onStatus = null;
 
       form.addEventListener("submit", submitForm);
       code_listener.addEventListener("input", updateValue);
       ssid_listener.addEventListener("input", updateValue);
       password_listener.addEventListener("input", updateValue);
 
-      const title_logo = `)rawliteral";
-// SVG_LOGO
-static constexpr const char index_html4[] PROGMEM =
-    R"rawliteral(`;
-      const title_text = `)rawliteral";
-// PROJECT_TITLE
-static constexpr const char index_html5[] PROGMEM =
-    R"rawliteral(`;
-      const title_sub = `)rawliteral";
-// PROJECT_SUB_TITLE
-static constexpr const char index_html6[] PROGMEM =
-    R"rawliteral(`;
-      const title_info = `)rawliteral";
-// PROJECT_INFO
-static constexpr const char index_html7[] PROGMEM =
-    R"rawliteral(`;
-      const input_name_text = `)rawliteral";
-// INPUT_NAME
-static constexpr const char index_html8[] PROGMEM =
-    R"rawliteral(`;
-      const input_lenght = )rawliteral";
-// INPUT_LENGHT
-static constexpr const char index_html9[] PROGMEM =
-    R"rawliteral(;
-      const connection_successful_text = `)rawliteral";
-// CONNECTION_SUCCESFUL
-static constexpr const char index_html10[] PROGMEM =
-    R"rawliteral(`;
-      const footer_text = `)rawliteral";
-// FOOTER_TEXT
-static constexpr const char index_html11[] PROGMEM =
-    R"rawliteral(`;
-      const reset_confirmation_text = `)rawliteral";
-// RESET_CONFIRMATION_TEXT
-
-static constexpr const char index_html12[] PROGMEM =
-    R"rawliteral(`;
-      const reset_show = )rawliteral";
-// RESET_SHOW
-static constexpr const char index_html13[] PROGMEM =
-    R"rawliteral(;
-    
       window.addEventListener("DOMContentLoaded", (event) => {
         document.getElementById("logo-container").innerHTML = title_logo;
         document.getElementById("app-title").textContent = title_text;
@@ -608,7 +571,7 @@ static constexpr const char index_html13[] PROGMEM =
       });
 
       window.addEventListener("load", (event) => {
-        loadSSID();
+        if (!openEvents()) loadSSID();
       });
 
       function updateValue(e) {
@@ -730,9 +693,12 @@ static constexpr const char index_html13[] PROGMEM =
             if (!response.ok) throw new Error("Failed to connect");
             return response.json();
           })
+          .then((jsonResponse) => waitForConnection(jsonResponse.job))
           .then((jsonResponse) => {
             if (jsonResponse.success) {
+              closeEvents();
               successPage(payload.ssid);
+              fetch("/complete", { method: "POST" }).catch(() => {});
             } else {
               if (jsonResponse.reason === "code") {
                 showError("code", `Invalid ${input_name_text}`, true);
@@ -758,6 +724,45 @@ static constexpr const char index_html13[] PROGMEM =
           });
       }
 
+      function waitForConnection(job) {
+        return new Promise((resolve, reject) => {
+          let done = false;
+          const finish = (status) => {
+            if (done || !status || status.job !== job) return;
+            if (status.state === "verified" || status.state === "failed") {
+              done = true;
+              onStatus = null;
+              resolve(status);
+            }
+          };
+          const poll = () => {
+            if (done) return;
+            // Status events settle the attempt while the stream is open
+            if (events && events.readyState === EventSource.OPEN) {
+              setTimeout(poll, 2000);
+              return;
+            }
+            fetch(`/status?job=${job}`)
+              .then((response) => {
+                if (!response.ok) throw new Error("Failed to get status");
+                return response.json();
+              })
+              .then((status) => {
+                finish(status);
+                setTimeout(poll, 500);
+              })
+              .catch((error) => {
+                done = true;
+                onStatus = null;
+                reject(error);
+              });
+          };
+          onStatus = finish;
+          finish(lastStatus);
+          poll();
+        });
+      }
+
       function successPage(ssid_text) {
         const card = document.getElementById("main-card");
         card.innerHTML = "";
@@ -809,17 +814,16 @@ static constexpr const char index_html13[] PROGMEM =
         refreshSpin(true);
         resetErrors();
 
-        fetch("/update")
+        fetch(scanVersion ? `/update?since=${scanVersion}` : "/update")
           .then((response) => {
             if (!response.ok) throw new Error("Network response was not ok");
             return response.json();
           })
           .then((jsonResponse) => {
-            document.getElementById("table-body").innerHTML = "";
-            jsonResponse.network.forEach(({ ssid, authmode, rssi }) =>
-              addTableRow(ssid, authmode, rssi)
-            );
-            showcodeField(jsonResponse.show_code);
+            applyUpdate(jsonResponse);
+            if (jsonResponse.scanning && !rows.size && !events) {
+              setTimeout(loadSSID, 1000);
+            }
           })
           .catch(() => {
             console.error("Error on Refresh");
@@ -831,11 +835,61 @@ static constexpr const char index_html13[] PROGMEM =
           });
       }
 
-      function addTableRow(ssid, authmode, rssi) {
+      function openEvents() {
+        if (!window.EventSource) return false;
+        events = new EventSource("/events");
+        events.addEventListener("scan", (event) => {
+          const update = JSON.parse(event.data);
+          applyUpdate(update);
+          refreshSpin(update.scanning && !rows.size);
+        });
+        events.addEventListener("status", (event) => {
+          lastStatus = JSON.parse(event.data);
+          if (onStatus) onStatus(lastStatus);
+        });
+        events.onerror = () => {
+          // Servers without streams refuse them, poll instead
+          if (events && events.readyState === EventSource.CLOSED) {
+            events = null;
+            loadSSID();
+          }
+        };
+        return true;
+      }
+
+      function closeEvents() {
+        if (events) {
+          events.close();
+          events = null;
+        }
+      }
+
+      function applyUpdate(update) {
+        if (update.since === undefined) {
+          rows.forEach((row) => row.remove());
+          rows.clear();
+        }
+        (update.removed || []).forEach((ssid) => {
+          const row = rows.get(ssid);
+          if (row) {
+            row.remove();
+            rows.delete(ssid);
+          }
+        });
+        update.network.forEach(({ ssid, authmode, rssi }) =>
+          setTableRow(ssid, authmode, rssi)
+        );
+        sortTable();
+        scanVersion = update.version;
+        showcodeField(update.show_code);
+      }
+
+      function setTableRow(ssid, authmode, rssi) {
         const locked = authmode > 0 ? 1 : 0;
         const icon = svgs["" + rssi + locked];
-        table.innerHTML += `
-       <tr>
+        const row = document.createElement("tr");
+        row.dataset.rssi = rssi;
+        row.innerHTML = `
            <td class="radiossid">
              <input type="radio" name="ssid" value="${ssid}" data-auth="${authmode}" onclick="onRadio(this)">
            </td>
@@ -843,8 +897,22 @@ static constexpr const char index_html13[] PROGMEM =
            <td class="signal">
              <svg xmlns="http://www.w3.org/2000/svg" style="vertical-align: -0.125em;" width="1em" height="1em" preserveAspectRatio="xMidYMid meet" viewBox="0 0 24 24"><path fill="var(--font-color)" ${icon}
            </td>
-       </tr>
        `;
+        const old = rows.get(ssid);
+        if (old) {
+          row.querySelector("input").checked =
+            old.querySelector("input").checked;
+          old.replaceWith(row);
+        } else {
+          table.appendChild(row);
+        }
+        rows.set(ssid, row);
+      }
+
+      function sortTable() {
+        Array.from(table.rows)
+          .sort((a, b) => b.dataset.rssi - a.dataset.rssi)
+          .forEach((row) => table.appendChild(row));
       }
 
       function togglePassShow() {
@@ -1008,6 +1076,49 @@ static constexpr const char index_html13[] PROGMEM =
 
         window.location.href = "/";
       }
+
+      const title_logo = `)rawliteral";
+// SVG_LOGO
+static constexpr const char index_html4[] PROGMEM =
+    R"rawliteral(`;
+      const title_text = `)rawliteral";
+// PROJECT_TITLE
+static constexpr const char index_html5[] PROGMEM =
+    R"rawliteral(`;
+      const title_sub = `)rawliteral";
+// PROJECT_SUB_TITLE
+static constexpr const char index_html6[] PROGMEM =
+    R"rawliteral(`;
+      const title_info = `)rawliteral";
+// PROJECT_INFO
+static constexpr const char index_html7[] PROGMEM =
+    R"rawliteral(`;
+      const input_name_text = `)rawliteral";
+// INPUT_NAME
+static constexpr const char index_html8[] PROGMEM =
+    R"rawliteral(`;
+      const input_lenght = )rawliteral";
+// INPUT_LENGHT
+static constexpr const char index_html9[] PROGMEM =
+    R"rawliteral(;
+      const connection_successful_text = `)rawliteral";
+// CONNECTION_SUCCESFUL
+static constexpr const char index_html10[] PROGMEM =
+    R"rawliteral(`;
+      const footer_text = `)rawliteral";
+// FOOTER_TEXT
+static constexpr const char index_html11[] PROGMEM =
+    R"rawliteral(`;
+      const reset_confirmation_text = `)rawliteral";
+// RESET_CONFIRMATION_TEXT
+
+static constexpr const char index_html12[] PROGMEM =
+    R"rawliteral(`;
+      const reset_show = )rawliteral";
+// RESET_SHOW
+static constexpr const char index_html13[] PROGMEM =
+    R"rawliteral(;
+
     </script>
   </body>
 </html>
@@ -0,0 +1,627 @@
+// Generated by extras/generate_gzip_html.py from provision_html.h.
+// Do not edit by hand, run the script after changing the page.
+#ifndef PROVISION_HTML_GZ_H
+#define PROVISION_HTML_GZ_H
+
+#include <Arduino.h>
+
+static constexpr const uint8_t index_html1_gz[] PROGMEM = {
+    0xe2, 0xb2, 0x51, 0x74, 0xf1, 0x77, 0x0e, 0x89, 0x0c, 0x70, 0x55, 0xc8, 0x28, 0xc9, 0xcd, 0xb1,
+    0xe3, 0xb2, 0x01, 0x51, 0x0a, 0x39, 0x89, 0x79, 0xe9, 0xb6, 0x4a, 0xa9, 0x79, 0x4a, 0x76, 0x5c,
+    0x0a, 0x0a, 0x36, 0x19, 0xa9, 0x89, 0x29, 0x20, 0x06, 0x90, 0x59, 0x92, 0x59, 0x92, 0x93, 0x6a,
+    0x07, 0x00, 0x00, 0x00, 0xff, 0xff,
+};
+
+static constexpr const uint8_t index_html2_gz[] PROGMEM = {
+    0x4c, 0x8e, 0x4b, 0x0e, 0x82, 0x40, 0x0c, 0x86, 0xf7, 0x9e, 0xa2, 0xc1, 0x2d, 0x23, 0x12, 0x13,
+    0xa3, 0x08, 0x2e, 0x3d, 0x81, 0x1e, 0xa0, 0x0e, 0x45, 0x26, 0xce, 0xc3, 0x0c, 0x05, 0x34, 0x5e,
+    0x5e, 0x40, 0x50, 0xda, 0x4d, 0xfb, 0x7f, 0x7f, 0x1f, 0x69, 0xc4, 0x8a, 0x35, 0x1d, 0x17, 0xd0,
+    0x45, 0x6a, 0x88, 0x11, 0x64, 0x89, 0xbe, 0x22, 0xce, 0x82, 0xcb, 0xf9, 0x24, 0x76, 0x01, 0x44,
+    0x33, 0x38, 0x54, 0x00, 0x16, 0x0d, 0x65, 0x41, 0xa3, 0xa8, 0x7d, 0x38, 0xcf, 0xc1, 0xa8, 0x4a,
+    0x67, 0x99, 0x6c, 0x37, 0xd8, 0xaa, 0x9c, 0xcb, 0x2c, 0xa7, 0x46, 0x49, 0x12, 0x43, 0x13, 0x82,
+    0xb2, 0x8a, 0x15, 0x6a, 0x51, 0x49, 0xd4, 0x94, 0xc5, 0xab, 0x75, 0x08, 0x06, 0x9f, 0xca, 0xd4,
+    0x66, 0x92, 0xbe, 0x6b, 0xa6, 0x6b, 0x15, 0xbf, 0xa6, 0xb7, 0x00, 0x12, 0xef, 0x1c, 0xc3, 0x7b,
+    0xec, 0x00, 0x84, 0x90, 0xe8, 0x73, 0x71, 0x45, 0x79, 0xbf, 0x79, 0x57, 0xdb, 0x3c, 0x81, 0x65,
+    0x31, 0xc4, 0x61, 0xe6, 0xf9, 0x63, 0x21, 0x9d, 0x76, 0xbe, 0x37, 0xed, 0xfb, 0x9c, 0x9b, 0x8a,
+    0xee, 0xe9, 0x1f, 0x8e, 0x31, 0x2e, 0x36, 0xdb, 0x39, 0xe6, 0x92, 0x0c, 0x4d, 0xfc, 0x03, 0x00,
+    0x00, 0xff, 0xff,
+};
+
+static constexpr const uint8_t index_html3_gz[] PROGMEM = {
+    0xec, 0x5d, 0x7b, 0x73, 0xdb, 0x46, 0x92, 0xff, 0x5f, 0x9f, 0x62, 0xc2, 0x64, 0x13, 0xf2, 0x56,
+    0x80, 0x08, 0x80, 0xe0, 0x43, 0xb4, 0xe4, 0x73, 0x94, 0xa4, 0x36, 0x57, 0xf6, 0xc6, 0x17, 0xf9,
+    0xb2, 0xb5, 0x49, 0xa5, 0x2c, 0x88, 0x04, 0x45, 0xc4, 0x20, 0x40, 0x03, 0xa0, 0x64, 0xc5, 0xab,
+    0xef, 0x7e, 0xdd, 0x3d, 0x03, 0x60, 0x66, 0x30, 0x00, 0x29, 0xc7, 0xde, 0xba, 0xda, 0x5b, 0x27,
+    0xe2, 0x63, 0x9e, 0x3d, 0x3d, 0x3d, 0xdd, 0xbf, 0xee, 0x19, 0x0c, 0xe7, 0x47, 0x4c, 0xfc, 0xb3,
+    0xac, 0x7c, 0x1d, 0x2c, 0xd3, 0x3b, 0x6b, 0x91, 0xc6, 0x69, 0x76, 0xca, 0xb2, 0x9b, 0xeb, 0xa0,
+    0x3f, 0x3c, 0x66, 0xe2, 0x7f, 0xdb, 0x19, 0xcc, 0xa5, 0xb2, 0xd7, 0x69, 0xb6, 0x0c, 0xb3, 0xb2,
+    0xec, 0xe7, 0x0b, 0xfa, 0x57, 0x16, 0x78, 0x38, 0x12, 0x1f, 0xfe, 0x83, 0xbd, 0xaf, 0xea, 0xac,
+    0xd2, 0xa4, 0xb0, 0x56, 0xc1, 0x26, 0x8a, 0xef, 0x4f, 0xd9, 0xcb, 0x74, 0xbb, 0x8d, 0x92, 0xfc,
+    0x98, 0xe5, 0x41, 0x92, 0x5b, 0x79, 0x98, 0x45, 0xab, 0xba, 0x75, 0xd1, 0xe8, 0x6d, 0x90, 0xf5,
+    0x2d, 0x8b, 0xaa, 0x51, 0xca, 0xa0, 0xd1, 0xfc, 0x75, 0xba, 0xbc, 0x97, 0x7a, 0x28, 0xd2, 0xdd,
+    0x62, 0x6d, 0x05, 0x8b, 0x22, 0x4a, 0x93, 0x53, 0xb6, 0x09, 0x92, 0x68, 0xbb, 0x8b, 0x03, 0xfc,
+    0x76, 0x78, 0xdb, 0xd0, 0x68, 0xb0, 0x78, 0x73, 0x93, 0xa5, 0xbb, 0x64, 0x69, 0x29, 0x85, 0xf5,
+    0x74, 0xa9, 0xca, 0x26, 0xc8, 0x6e, 0x22, 0xe8, 0xd2, 0xcd, 0xc2, 0x0d, 0x1b, 0xd6, 0xe9, 0xcb,
+    0x28, 0xdf, 0xc6, 0x01, 0x0c, 0x77, 0x15, 0x87, 0xef, 0xea, 0x64, 0xfc, 0x66, 0x2d, 0xa3, 0x2c,
+    0x14, 0x94, 0x42, 0x73, 0xbb, 0x8d, 0x44, 0x63, 0x10, 0x47, 0x37, 0x89, 0x15, 0x15, 0xe1, 0x26,
+    0x87, 0xcc, 0x30, 0x29, 0xc2, 0xac, 0xce, 0xfc, 0x6d, 0x97, 0x17, 0xd1, 0xea, 0x1e, 0x68, 0x80,
+    0xf4, 0xa4, 0x68, 0x16, 0xd8, 0x44, 0x89, 0xb5, 0x0e, 0xa3, 0x9b, 0x35, 0xe4, 0x39, 0xc3, 0xe1,
+    0xed, 0xba, 0xc1, 0xb6, 0x22, 0xb8, 0x8e, 0x43, 0x89, 0x6f, 0xf5, 0x5c, 0xc6, 0xc1, 0x36, 0x0f,
+    0x89, 0x20, 0xfa, 0x54, 0x37, 0x7a, 0x17, 0x2d, 0x8b, 0x35, 0xb5, 0xf7, 0x27, 0x7d, 0xd8, 0x20,
+    0x0a, 0x45, 0x91, 0x6e, 0x4e, 0x41, 0x44, 0x7c, 0x18, 0x7f, 0x23, 0xbb, 0x48, 0xb7, 0x7a, 0x5e,
+    0x4d, 0xc9, 0xfa, 0xb8, 0xfc, 0xb4, 0x94, 0x08, 0xda, 0x06, 0xcb, 0x65, 0x94, 0xdc, 0x60, 0xb5,
+    0x89, 0xda, 0x66, 0x11, 0xbe, 0x2b, 0x2c, 0xe2, 0xcf, 0x29, 0x8b, 0xc3, 0x55, 0x61, 0x68, 0x51,
+    0x17, 0xb9, 0x3b, 0xc1, 0x8b, 0xeb, 0x34, 0x5e, 0x36, 0xe4, 0xe0, 0x73, 0x8f, 0xfe, 0x35, 0x9a,
+    0xb1, 0xd7, 0x61, 0x00, 0x3c, 0x91, 0x85, 0x4b, 0xea, 0x59, 0x65, 0x79, 0x55, 0xe9, 0x3f, 0xf3,
+    0xdd, 0x76, 0x9b, 0x66, 0x45, 0xce, 0xfa, 0xd0, 0xeb, 0xf5, 0x9b, 0x08, 0x2a, 0x6c, 0xb7, 0x61,
+    0x90, 0x05, 0xc9, 0x02, 0xb8, 0x9a, 0xa4, 0x49, 0x38, 0x60, 0x69, 0x06, 0xb9, 0x9b, 0xf4, 0x77,
+    0x43, 0x56, 0xdd, 0x59, 0x94, 0x6c, 0x77, 0xc5, 0x2f, 0xc5, 0xfd, 0x36, 0x3c, 0xeb, 0x65, 0xc1,
+    0x32, 0x4a, 0x7b, 0xbf, 0x4a, 0xb9, 0xb8, 0xfe, 0x50, 0xca, 0x6f, 0xc3, 0x52, 0x36, 0x8b, 0x75,
+    0xb8, 0x09, 0x1b, 0x62, 0x59, 0x97, 0xb3, 0xa2, 0x24, 0x09, 0x2b, 0x49, 0x5e, 0x04, 0xd9, 0x52,
+    0x12, 0x67, 0xad, 0x86, 0x90, 0x86, 0x75, 0x7a, 0x5b, 0xd7, 0x68, 0x6f, 0xbf, 0x6e, 0xe6, 0xa0,
+    0xd6, 0x5b, 0xd8, 0xa2, 0x94, 0x31, 0x31, 0xc7, 0xd4, 0x48, 0x11, 0x6c, 0xad, 0x35, 0xcc, 0x6d,
+    0x8c, 0xf3, 0x5b, 0xae, 0xd5, 0x02, 0x2a, 0xe5, 0xdb, 0x20, 0x83, 0x19, 0x92, 0xeb, 0x54, 0x0b,
+    0xc2, 0xf6, 0x1c, 0x57, 0x15, 0x29, 0xc6, 0x60, 0xa0, 0x45, 0xb4, 0x08, 0xe2, 0x72, 0x7a, 0x37,
+    0xd1, 0x72, 0x19, 0x2b, 0x5d, 0xa6, 0xbb, 0x22, 0x8e, 0x12, 0x03, 0x2d, 0xd5, 0x0a, 0x8f, 0x12,
+    0x2c, 0x60, 0x5d, 0xc7, 0xe9, 0xe2, 0x8d, 0x5c, 0x60, 0x9b, 0xe6, 0x11, 0x5f, 0xe5, 0x59, 0x88,
+    0xba, 0xe8, 0x56, 0xa9, 0x5e, 0x2a, 0x8e, 0xa1, 0x9c, 0xb8, 0xd8, 0x65, 0x39, 0x0e, 0x65, 0x9b,
+    0x46, 0xea, 0xca, 0x2e, 0x57, 0x2a, 0xae, 0x8b, 0xe1, 0x98, 0x86, 0xc1, 0xf2, 0x34, 0x8e, 0x96,
+    0xa5, 0x86, 0x5a, 0x1c, 0x97, 0x9f, 0x24, 0xed, 0x3c, 0x50, 0x66, 0xa0, 0x39, 0x5f, 0xd7, 0xc7,
+    0x0d, 0x05, 0xa7, 0x56, 0x21, 0x96, 0x8a, 0x41, 0xd4, 0x65, 0x80, 0x06, 0x0f, 0xf4, 0xb7, 0xdc,
+    0x53, 0x95, 0xf4, 0x4e, 0x98, 0x12, 0x48, 0x70, 0x73, 0xb9, 0xa9, 0x2f, 0x4f, 0x83, 0x55, 0xa1,
+    0x2c, 0x2b, 0xbe, 0x16, 0x85, 0x2a, 0xeb, 0xf5, 0xe6, 0x4a, 0x46, 0xc5, 0xdd, 0x06, 0x5b, 0x19,
+    0xad, 0x7e, 0x8d, 0x71, 0x68, 0x01, 0xb6, 0x8d, 0xb4, 0x7a, 0x06, 0x82, 0x6b, 0xe0, 0xd6, 0xae,
+    0x08, 0xb5, 0x3a, 0xd2, 0xf0, 0xe8, 0xf3, 0x2a, 0xcd, 0x36, 0x82, 0x25, 0x4b, 0xab, 0x38, 0xa6,
+    0x51, 0x0d, 0xea, 0x04, 0x2b, 0x3c, 0x66, 0x61, 0x90, 0x87, 0x83, 0x63, 0xa5, 0x19, 0x10, 0x92,
+    0x6d, 0xb0, 0x88, 0x8a, 0xfb, 0xaa, 0x64, 0x7a, 0x4c, 0xe3, 0x57, 0x78, 0xf9, 0xa0, 0x30, 0x63,
+    0xb1, 0x0e, 0x17, 0x6f, 0xc2, 0xa5, 0xc6, 0x0e, 0x98, 0x89, 0x72, 0x6e, 0xf8, 0xea, 0x1d, 0xcc,
+    0xf5, 0xfc, 0xc5, 0x9e, 0x02, 0xd0, 0xf9, 0x29, 0xd1, 0xdd, 0xcc, 0x40, 0xa6, 0xd9, 0x63, 0x53,
+    0x86, 0x85, 0x9a, 0x7f, 0x77, 0x1d, 0x2d, 0xac, 0xeb, 0xf0, 0xf7, 0x28, 0xcc, 0xfa, 0x40, 0x3d,
+    0x0e, 0x61, 0xea, 0x13, 0x0f, 0xe0, 0xb3, 0x63, 0xbb, 0x1d, 0xa3, 0x21, 0x8d, 0xa1, 0x8d, 0xe5,
+    0xcb, 0xd3, 0x24, 0x2d, 0xfa, 0xe5, 0x40, 0x07, 0x5a, 0x6e, 0x95, 0x0f, 0x13, 0x8d, 0x36, 0xc9,
+    0x50, 0x40, 0x1d, 0xae, 0xac, 0x9b, 0xb4, 0x41, 0xab, 0xd4, 0xa8, 0xdf, 0x54, 0x3a, 0x57, 0xe9,
+    0x62, 0x97, 0x6b, 0x1d, 0xd5, 0x32, 0x0b, 0xec, 0xa1, 0xff, 0x78, 0x87, 0x32, 0x24, 0xea, 0x18,
+    0x3a, 0x0e, 0xc2, 0xce, 0xef, 0xa2, 0x62, 0xb1, 0xd6, 0x87, 0x50, 0x5a, 0x4e, 0x93, 0xe2, 0x69,
+    0x5b, 0x10, 0x95, 0x2c, 0x95, 0xe3, 0x46, 0x51, 0xd2, 0xc6, 0xfb, 0xa0, 0xb5, 0x63, 0x96, 0x25,
+    0x64, 0x1f, 0x88, 0x82, 0x33, 0x3f, 0x80, 0x37, 0x0f, 0x07, 0x9b, 0x1f, 0x31, 0x0d, 0x98, 0xb5,
+    0x03, 0x88, 0xe2, 0xcb, 0xa0, 0xa0, 0x6d, 0x4c, 0x15, 0x1f, 0x9c, 0xe9, 0xa4, 0xc9, 0x87, 0x5a,
+    0x3f, 0x1b, 0xb3, 0xbb, 0x3b, 0x34, 0x69, 0x35, 0xd9, 0xee, 0x69, 0x9c, 0xab, 0x78, 0x3b, 0x34,
+    0x28, 0x02, 0x5c, 0xfc, 0xa7, 0x2c, 0x07, 0x6b, 0x10, 0xf6, 0x85, 0x08, 0xa0, 0xf4, 0x4f, 0x06,
+    0x1f, 0xb0, 0x8c, 0x73, 0xc2, 0x3d, 0xf3, 0x4e, 0x66, 0x9b, 0xc0, 0x03, 0x48, 0x53, 0x07, 0x82,
+    0x18, 0xb0, 0x20, 0x59, 0x56, 0xed, 0x88, 0xc2, 0x46, 0x40, 0xb1, 0x07, 0x51, 0x18, 0xe9, 0x0e,
+    0x16, 0x08, 0x6e, 0x54, 0xe4, 0x6b, 0xb6, 0xfe, 0x8d, 0x11, 0x04, 0xd5, 0x32, 0x2e, 0x35, 0x23,
+    0x75, 0xda, 0x48, 0xbd, 0xde, 0x01, 0x5e, 0x4c, 0xaa, 0x64, 0xa9, 0xfb, 0xd2, 0xf2, 0xc1, 0x98,
+    0xc0, 0x16, 0xc7, 0xe9, 0x5d, 0x28, 0x21, 0x36, 0x61, 0x0e, 0xad, 0xf0, 0x16, 0x08, 0xcc, 0x75,
+    0x53, 0x5c, 0x4f, 0x6a, 0xcd, 0xf1, 0x1a, 0xcd, 0xe5, 0x60, 0xd7, 0x83, 0xb8, 0x24, 0xc0, 0x26,
+    0x06, 0xe4, 0x79, 0xb4, 0x7c, 0x1c, 0xbe, 0xb3, 0x11, 0xda, 0xc8, 0xb8, 0xb9, 0xc5, 0x53, 0x68,
+    0x47, 0x40, 0x9a, 0x9a, 0xb1, 0xb9, 0x0d, 0x17, 0x28, 0xb7, 0x5b, 0xe5, 0x68, 0x4b, 0xa0, 0x81,
+    0x8c, 0x37, 0xc1, 0x3b, 0x4b, 0xac, 0x31, 0x7f, 0xa8, 0xe4, 0x88, 0x54, 0x10, 0xe9, 0x45, 0x1f,
+    0x01, 0x3c, 0xb3, 0x18, 0x56, 0x95, 0xda, 0xae, 0xf0, 0xb6, 0x6b, 0x00, 0xf0, 0xb0, 0x28, 0x5b,
+    0x21, 0x78, 0x2b, 0xa3, 0xc0, 0xa2, 0x07, 0x80, 0x87, 0xb2, 0x26, 0xa8, 0xe7, 0xfe, 0x80, 0x63,
+    0xbb, 0xfe, 0x63, 0x5b, 0xfd, 0x7c, 0x0d, 0xb8, 0x2c, 0x4c, 0xac, 0x24, 0x2c, 0xee, 0xd2, 0xec,
+    0x0d, 0x78, 0x8d, 0x31, 0x78, 0x50, 0xa9, 0xdc, 0x87, 0x70, 0x39, 0x38, 0x36, 0x98, 0x34, 0x5d,
+    0x95, 0x8c, 0x6b, 0x19, 0x39, 0x67, 0xaf, 0x47, 0x61, 0x47, 0x30, 0x9a, 0xd7, 0x5c, 0x68, 0xa5,
+    0xae, 0x1e, 0x8f, 0x42, 0x9b, 0xe2, 0xb2, 0xaf, 0x58, 0x16, 0xc2, 0x8a, 0x2e, 0x50, 0xd4, 0xc5,
+    0x47, 0x5d, 0x1c, 0xf4, 0x55, 0xd0, 0x0a, 0x1d, 0xd1, 0x60, 0xae, 0x62, 0x14, 0x3b, 0xce, 0x44,
+    0x29, 0xc7, 0x04, 0x6d, 0xe5, 0xc1, 0x27, 0x56, 0xbe, 0x25, 0x35, 0x2a, 0x0d, 0x1e, 0x5c, 0xeb,
+    0x4d, 0xc0, 0x21, 0x13, 0x66, 0x5a, 0xd5, 0x77, 0x5c, 0x7e, 0x39, 0xac, 0xfb, 0x55, 0x94, 0x44,
+    0x32, 0xd0, 0xea, 0xc4, 0xc9, 0xb5, 0x0e, 0x7c, 0x13, 0xde, 0xaf, 0xb2, 0x60, 0x13, 0xe6, 0x7a,
+    0xb3, 0x75, 0xd7, 0x20, 0xbf, 0xef, 0x8f, 0x8c, 0x4a, 0x3b, 0x4b, 0x8b, 0xa0, 0x08, 0xfb, 0xc3,
+    0x65, 0x78, 0xa3, 0xa8, 0xa9, 0xea, 0x23, 0x09, 0x7f, 0x77, 0x65, 0xcf, 0x9f, 0xe9, 0xd5, 0x75,
+    0x8e, 0xa0, 0xc0, 0x90, 0x62, 0x93, 0x9a, 0x12, 0x4b, 0x6c, 0xe2, 0xff, 0x49, 0x5b, 0xeb, 0xd1,
+    0xef, 0xb4, 0xae, 0xc4, 0xe2, 0x85, 0x24, 0xe3, 0x82, 0x75, 0xa6, 0xfa, 0x6a, 0x96, 0x3c, 0xe0,
+    0xb1, 0xb6, 0x52, 0x6a, 0x1f, 0xc0, 0x31, 0xb8, 0x00, 0x32, 0xf0, 0x9f, 0x37, 0x84, 0xb5, 0xa1,
+    0x44, 0x1a, 0xa0, 0x64, 0x7f, 0x89, 0x4a, 0xf0, 0x25, 0xdc, 0x8c, 0xb3, 0x2e, 0x2d, 0xa9, 0xd6,
+    0x9c, 0x6e, 0x61, 0xfb, 0x7c, 0x1b, 0xe4, 0x39, 0x2c, 0xed, 0x96, 0x50, 0x80, 0xf0, 0x78, 0x1c,
+    0xdb, 0x1f, 0x97, 0x7a, 0x53, 0xfb, 0x30, 0x6f, 0x9f, 0xac, 0x06, 0xea, 0x53, 0x03, 0x58, 0xed,
+    0x86, 0xae, 0x6a, 0x2b, 0x0e, 0xae, 0xc3, 0x58, 0x6a, 0xa0, 0xcd, 0x39, 0xa1, 0xa0, 0x03, 0x4c,
+    0x7c, 0x88, 0x34, 0xcf, 0x4c, 0xb3, 0x2a, 0x45, 0x4c, 0x1c, 0x33, 0xdd, 0x9f, 0xaf, 0xd2, 0x14,
+    0x21, 0x14, 0x28, 0xd2, 0xed, 0x3d, 0x29, 0xad, 0xa6, 0xb0, 0x99, 0x62, 0x31, 0xa0, 0xc1, 0x6d,
+    0x1f, 0x19, 0xc2, 0x5c, 0x35, 0x12, 0xa5, 0x10, 0x35, 0x7d, 0xac, 0x3a, 0x0f, 0xb3, 0x2c, 0xcd,
+    0x2c, 0x58, 0x96, 0x79, 0x70, 0x23, 0x07, 0x8e, 0xea, 0xe8, 0xdf, 0x70, 0x58, 0x07, 0x51, 0x0e,
+    0x64, 0x8d, 0x26, 0xf1, 0xa4, 0x16, 0x4a, 0x18, 0x08, 0x8c, 0xf3, 0x26, 0xbe, 0xd1, 0x18, 0x55,
+    0x12, 0x89, 0x06, 0xb4, 0x85, 0x54, 0x05, 0xed, 0xe0, 0x00, 0x7b, 0xbf, 0x1e, 0xb7, 0x17, 0x28,
+    0xa5, 0x4e, 0x01, 0xb9, 0x4d, 0x65, 0xfd, 0xf9, 0x6a, 0x11, 0x8e, 0xc2, 0xd1, 0xbc, 0x45, 0x82,
+    0x34, 0x26, 0xd4, 0x14, 0x5d, 0x17, 0x89, 0xb5, 0xcd, 0xd2, 0x05, 0x70, 0xef, 0x23, 0x9b, 0x8f,
+    0x2e, 0x74, 0xd6, 0x86, 0x34, 0xda, 0x80, 0x86, 0xec, 0xcc, 0x0e, 0xcb, 0x72, 0x8e, 0xbd, 0x1f,
+    0x97, 0x48, 0x73, 0xea, 0x18, 0xf5, 0x94, 0x86, 0xd3, 0xcc, 0x91, 0x94, 0xbd, 0xfa, 0xae, 0x4b,
+    0x23, 0x55, 0x13, 0xb4, 0x5a, 0xed, 0x35, 0x85, 0x0a, 0x46, 0x49, 0x00, 0x3f, 0x58, 0x8d, 0x48,
+    0x9f, 0x12, 0xb7, 0x34, 0x45, 0x34, 0xab, 0xe5, 0x6b, 0xd6, 0xd8, 0x8f, 0x03, 0x35, 0x82, 0x0c,
+    0x54, 0x0b, 0x19, 0xd6, 0xd7, 0x7d, 0x27, 0x63, 0x70, 0x64, 0x4f, 0xd8, 0xa9, 0xd4, 0x10, 0x06,
+    0xda, 0x45, 0xd8, 0x44, 0x0b, 0xd5, 0x56, 0xee, 0x97, 0x9c, 0xb8, 0x2f, 0x2c, 0xd6, 0xe5, 0x94,
+    0x49, 0x46, 0x8a, 0xfb, 0x73, 0xc2, 0x4a, 0xa9, 0x73, 0xa4, 0xad, 0x20, 0xc8, 0x93, 0x45, 0xbf,
+    0x91, 0x30, 0x37, 0xe1, 0x0f, 0x64, 0x1a, 0xc2, 0xc9, 0x9c, 0x34, 0x48, 0x90, 0x35, 0xc0, 0x87,
+    0x09, 0x5d, 0x50, 0xa5, 0x7f, 0x1a, 0xa6, 0x18, 0x0f, 0xf7, 0x61, 0x8a, 0xbb, 0x0c, 0x9d, 0xb7,
+    0xcc, 0x64, 0x5d, 0xd4, 0xad, 0x83, 0xbd, 0xd1, 0xff, 0x8e, 0xbd, 0x03, 0x49, 0xf4, 0xd1, 0xf1,
+    0x03, 0x81, 0x78, 0xf3, 0xfa, 0xf5, 0x22, 0xca, 0x16, 0xca, 0x66, 0x40, 0x5e, 0x64, 0xe9, 0x9b,
+    0xd0, 0x5a, 0x06, 0xb0, 0xde, 0xb3, 0x0c, 0x29, 0x70, 0xc6, 0xe3, 0xb9, 0x29, 0x3b, 0x5d, 0xad,
+    0xf2, 0xb0, 0x30, 0xe7, 0x0b, 0x09, 0x74, 0x1b, 0x19, 0x1b, 0x20, 0x2d, 0x8b, 0x23, 0x78, 0x43,
+    0x0b, 0xa6, 0x67, 0x83, 0x10, 0x4c, 0x82, 0x85, 0x33, 0x92, 0xea, 0xad, 0xa2, 0x38, 0xd6, 0xb5,
+    0x85, 0x0c, 0x3f, 0xa9, 0x1e, 0x85, 0xb4, 0xf4, 0xe0, 0xd5, 0xd8, 0x17, 0x3b, 0x57, 0x23, 0xf8,
+    0xe0, 0x0c, 0x40, 0x53, 0x65, 0x77, 0xe0, 0x99, 0xe5, 0x1d, 0xfc, 0x68, 0x5a, 0x59, 0xaf, 0x65,
+    0xa5, 0xe8, 0xe9, 0x5d, 0x8b, 0xa1, 0xcd, 0x1c, 0xee, 0xe1, 0x95, 0xae, 0xd1, 0xf6, 0x70, 0x50,
+    0x56, 0x5b, 0x9e, 0x46, 0x5b, 0x6d, 0x0b, 0xa2, 0x04, 0xe6, 0x8c, 0xd4, 0x9a, 0xf4, 0xd2, 0x60,
+    0xba, 0xc4, 0x60, 0xe4, 0x3f, 0xf2, 0x30, 0xa7, 0xa0, 0xa7, 0x05, 0x3d, 0x80, 0x0a, 0xe7, 0x09,
+    0x25, 0x43, 0x65, 0xdb, 0x41, 0x91, 0x13, 0x0a, 0x3d, 0x6a, 0xe5, 0x67, 0x39, 0xd0, 0x51, 0xac,
+    0xbb, 0x85, 0x11, 0x3f, 0xca, 0x3e, 0x79, 0xb9, 0x96, 0xac, 0x14, 0x40, 0x10, 0x5a, 0x7f, 0xe0,
+    0xab, 0xca, 0xdb, 0xa6, 0xb8, 0x8e, 0xa6, 0x9d, 0xd2, 0x2a, 0x67, 0x9b, 0xe4, 0xc8, 0xdb, 0x2b,
+    0x47, 0x00, 0xa0, 0xf2, 0x76, 0x61, 0x92, 0x7d, 0x18, 0xde, 0xe6, 0xfb, 0x76, 0x65, 0x61, 0xa0,
+    0x6f, 0xd8, 0xa1, 0x27, 0xe4, 0xb6, 0x89, 0xcf, 0xb2, 0x0a, 0x3b, 0x3e, 0x48, 0x27, 0xa9, 0x0b,
+    0x49, 0x52, 0x64, 0x7e, 0x7b, 0x1d, 0xea, 0xcb, 0x5b, 0xf6, 0x1d, 0xdb, 0xc1, 0x18, 0x30, 0xbe,
+    0x0c, 0x0e, 0xa3, 0x92, 0x84, 0xa7, 0x63, 0xfc, 0x7b, 0x25, 0xd3, 0xb1, 0x85, 0xf9, 0x68, 0x88,
+    0x68, 0xdd, 0x2d, 0xbe, 0x3e, 0x39, 0xc9, 0x8b, 0xfb, 0x38, 0x3c, 0x3f, 0xc2, 0x8f, 0x68, 0xd1,
+    0xcf, 0x91, 0x9a, 0x27, 0xb8, 0x41, 0x7c, 0xce, 0x0b, 0x2c, 0xa3, 0x5b, 0xb6, 0x88, 0x01, 0xea,
+    0x9d, 0xf5, 0xb8, 0xc5, 0xef, 0x9d, 0x8b, 0x16, 0x28, 0x2b, 0x5a, 0x9e, 0xf5, 0xe2, 0xf4, 0x26,
+    0xb5, 0xaa, 0xd0, 0x45, 0xef, 0xfc, 0xc9, 0x09, 0xe4, 0x54, 0xa5, 0xd6, 0x2e, 0x15, 0x02, 0x45,
+    0x6d, 0x15, 0x51, 0x11, 0x87, 0x3d, 0x46, 0x5d, 0x9e, 0xf5, 0x0c, 0xfb, 0x9c, 0x0d, 0xa4, 0x00,
+    0x89, 0xd8, 0xde, 0xda, 0xad, 0x9b, 0x1b, 0x55, 0xcd, 0xe5, 0xbb, 0xeb, 0xae, 0x16, 0xdd, 0xb2,
+    0xf2, 0xa8, 0xaa, 0xbc, 0xad, 0xe3, 0x7a, 0xd0, 0x06, 0x58, 0xbc, 0xd4, 0x22, 0x98, 0x2b, 0x09,
+    0x3e, 0x35, 0x74, 0x64, 0x8a, 0x7a, 0xaa, 0x21, 0x49, 0x44, 0xbe, 0x16, 0xda, 0x1f, 0x50, 0x4f,
+    0x59, 0x18, 0xbc, 0xb1, 0x30, 0x41, 0xd9, 0xfb, 0x12, 0xa1, 0x83, 0xce, 0x42, 0x92, 0x33, 0x3b,
+    0x53, 0x83, 0xb3, 0x15, 0x6e, 0x67, 0xc1, 0xae, 0x48, 0x95, 0x7d, 0xa5, 0x56, 0x74, 0xc4, 0x58,
+    0x49, 0x39, 0x0c, 0x7b, 0x2b, 0x26, 0xb0, 0x9e, 0x8c, 0x6a, 0xc2, 0x36, 0x30, 0x51, 0x14, 0x6d,
+    0xeb, 0x95, 0x53, 0x4b, 0x5f, 0x2a, 0x36, 0xd1, 0x4e, 0x0e, 0x16, 0x14, 0x21, 0xa3, 0xd7, 0x98,
+    0xd0, 0x63, 0x09, 0xc8, 0xa6, 0x96, 0x76, 0x5e, 0xf5, 0xfc, 0x64, 0xed, 0x55, 0x8d, 0x29, 0x08,
+    0xb1, 0x77, 0x7e, 0xc1, 0xbf, 0xb3, 0x22, 0x65, 0x7f, 0x8b, 0x56, 0x11, 0xcc, 0x88, 0x27, 0xd5,
+    0x43, 0xa2, 0x04, 0xdb, 0x2b, 0x96, 0xbd, 0x3b, 0xa5, 0x51, 0x4b, 0xcd, 0x43, 0x41, 0xda, 0x7e,
+    0x3f, 0x57, 0x62, 0xc5, 0x4f, 0x0a, 0x2e, 0xb3, 0x6a, 0xe8, 0xfe, 0x49, 0x91, 0x9d, 0x37, 0xb6,
+    0x43, 0xa0, 0x68, 0x49, 0x5f, 0x15, 0xc6, 0xec, 0x35, 0x8b, 0xa1, 0xf0, 0x53, 0xc8, 0xca, 0x90,
+    0xc3, 0xca, 0x06, 0xa4, 0xc8, 0x56, 0xcf, 0x58, 0x8e, 0x3b, 0x48, 0x5d, 0x25, 0xd2, 0x64, 0x11,
+    0x47, 0x8b, 0x37, 0xb8, 0x78, 0x82, 0xe5, 0xe5, 0xe5, 0xf7, 0xdf, 0xf4, 0x07, 0x73, 0x53, 0xc9,
+    0x73, 0x63, 0xed, 0x27, 0xf9, 0xed, 0x8d, 0x31, 0x83, 0xb1, 0x77, 0x9b, 0x38, 0xc1, 0xb5, 0x5a,
+    0x14, 0xdb, 0xd3, 0x93, 0x93, 0xbb, 0xbb, 0x3b, 0xfb, 0xce, 0xb3, 0xd3, 0xec, 0xe6, 0xc4, 0x1d,
+    0x0e, 0x87, 0x27, 0x50, 0xaf, 0xd7, 0x52, 0x11, 0xe7, 0x3b, 0x0b, 0x57, 0x59, 0x98, 0xaf, 0x2d,
+    0x1c, 0x60, 0x5b, 0x39, 0x31, 0x57, 0x3a, 0xca, 0xb5, 0xc8, 0x29, 0x87, 0x15, 0xd7, 0x52, 0x8d,
+    0xa4, 0xfc, 0xac, 0xe7, 0xb4, 0x97, 0xe0, 0x10, 0xa1, 0xb3, 0xc8, 0x16, 0xa8, 0x0b, 0xb3, 0x5b,
+    0xb0, 0x90, 0x5b, 0x10, 0xa8, 0x0c, 0x6d, 0xd0, 0x59, 0xef, 0xdd, 0x8b, 0x68, 0xf9, 0x77, 0xf8,
+    0x63, 0x9b, 0x30, 0x2c, 0xda, 0x6a, 0xde, 0x46, 0xe1, 0x1d, 0x68, 0xcd, 0xb3, 0x1e, 0xee, 0x51,
+    0x39, 0xbe, 0x37, 0xa6, 0x17, 0x73, 0xe9, 0xf3, 0x96, 0x36, 0x9e, 0x6c, 0x83, 0x62, 0xdd, 0x92,
+    0xc7, 0x01, 0x17, 0xb0, 0x45, 0x3f, 0x20, 0xd3, 0x6b, 0xad, 0x00, 0xfc, 0x7e, 0xe1, 0xf8, 0x8e,
+    0xc3, 0x66, 0xee, 0xf4, 0xed, 0x90, 0xf9, 0x96, 0xc3, 0x26, 0x6f, 0xad, 0xf1, 0x88, 0xb9, 0xe3,
+    0xa9, 0x05, 0x7f, 0x6c, 0xe4, 0x8d, 0x6c, 0xff, 0xd5, 0x04, 0x52, 0x90, 0xd6, 0xb7, 0x96, 0x33,
+    0x1a, 0xb3, 0xa1, 0xe5, 0x4e, 0x5d, 0xdb, 0xb7, 0x7c, 0xff, 0x95, 0xeb, 0x4d, 0x99, 0xe3, 0xb9,
+    0xa3, 0xd8, 0x72, 0xdc, 0x19, 0x83, 0x3f, 0x28, 0x01, 0xef, 0x33, 0x6b, 0xe4, 0xc3, 0x6b, 0x01,
+    0x6f, 0x16, 0xbe, 0x51, 0xc2, 0x4f, 0xb3, 0xf1, 0xf0, 0x2d, 0xd4, 0x1d, 0xf3, 0xfc, 0x82, 0xf2,
+    0xd6, 0xa3, 0xd1, 0xf4, 0x2d, 0x24, 0x0d, 0x19, 0xaf, 0x01, 0xb5, 0x21, 0xcb, 0xa2, 0x37, 0x68,
+    0xd4, 0x9b, 0x40, 0xf3, 0x93, 0xb7, 0x13, 0x87, 0x8d, 0xa1, 0xda, 0xd8, 0x01, 0x33, 0xe4, 0x16,
+    0xe0, 0x96, 0x30, 0xa0, 0xc5, 0xf1, 0x46, 0x18, 0x2c, 0xf1, 0x87, 0xd6, 0xd8, 0x87, 0xb4, 0xb1,
+    0xe5, 0x4c, 0x66, 0x6f, 0x1d, 0x07, 0xde, 0x98, 0xef, 0x59, 0x8e, 0x33, 0x79, 0x0b, 0x43, 0xf0,
+    0x98, 0x07, 0x5d, 0x7a, 0x6b, 0x67, 0xe6, 0x42, 0x05, 0x2c, 0x0f, 0x94, 0xb3, 0x99, 0xed, 0x17,
+    0xf0, 0x47, 0x5f, 0x7e, 0xdf, 0xb8, 0xbe, 0x35, 0x1d, 0x0e, 0x6f, 0x91, 0x12, 0xc8, 0x1f, 0x5b,
+    0x82, 0x06, 0x22, 0x68, 0x6d, 0x61, 0x32, 0x12, 0x3d, 0x54, 0x06, 0x53, 0xd0, 0x6b, 0xec, 0x78,
+    0x53, 0x20, 0x72, 0xfa, 0xdf, 0xb3, 0xf1, 0x0c, 0x28, 0x19, 0xb3, 0x09, 0xb0, 0x0c, 0xde, 0x81,
+    0x0b, 0x48, 0x9c, 0x05, 0xc4, 0xb1, 0xb1, 0xff, 0xca, 0xf3, 0x5c, 0xb0, 0xd1, 0x43, 0x48, 0x85,
+    0x01, 0x4c, 0x2c, 0xdf, 0x63, 0x48, 0x9d, 0x05, 0x45, 0x3d, 0xcb, 0x83, 0x2e, 0xbd, 0xbf, 0xf8,
+    0x98, 0xe9, 0x61, 0x0d, 0x64, 0x2c, 0x90, 0xf6, 0xca, 0x99, 0xb2, 0xf1, 0x70, 0x7a, 0x6b, 0x4d,
+    0xde, 0x8e, 0x7d, 0x9a, 0x09, 0x77, 0x02, 0x14, 0x88, 0xd9, 0x98, 0xb2, 0xe1, 0x5b, 0x9a, 0x09,
+    0xe6, 0x4e, 0x47, 0xcc, 0xf7, 0xb1, 0xbc, 0x3b, 0x9b, 0x30, 0xd7, 0x71, 0x81, 0xa4, 0x21, 0x4e,
+    0xc6, 0x5b, 0x20, 0x90, 0x06, 0x82, 0x34, 0x4b, 0xbc, 0xfd, 0xbd, 0x4d, 0x18, 0x50, 0x5d, 0x83,
+    0x6c, 0xb5, 0x2c, 0x76, 0x5c, 0xb5, 0x46, 0x4d, 0x75, 0xc2, 0x35, 0x8c, 0x41, 0xd9, 0x9d, 0x98,
+    0x1a, 0x03, 0x15, 0x78, 0x8e, 0xaa, 0xa6, 0x35, 0xb7, 0xd4, 0x6f, 0x7c, 0xdb, 0xa7, 0x77, 0x7e,
+    0x49, 0xef, 0xa6, 0xe2, 0x90, 0xa6, 0xe9, 0x58, 0x2c, 0xd5, 0xd0, 0xc5, 0x4f, 0x0a, 0x3a, 0x6a,
+    0x86, 0xaa, 0x85, 0xb4, 0xb7, 0x85, 0x5f, 0xd1, 0x26, 0x17, 0x35, 0xc2, 0xa8, 0xaa, 0xab, 0xea,
+    0x5d, 0x01, 0x11, 0x92, 0xed, 0x6a, 0xd9, 0xcc, 0x50, 0x4d, 0xc5, 0xf6, 0xfc, 0x2f, 0x54, 0x8c,
+    0xfd, 0x95, 0x17, 0x63, 0x4f, 0x2b, 0x7b, 0x58, 0x37, 0xa7, 0x91, 0x4a, 0xa1, 0xad, 0x23, 0x93,
+    0x1e, 0xe7, 0xfb, 0x7e, 0x47, 0x4d, 0x75, 0xc9, 0x69, 0x29, 0x0d, 0xa2, 0xb1, 0x18, 0xb7, 0x99,
+    0x64, 0x6c, 0xb4, 0x9c, 0xdb, 0x20, 0xde, 0x85, 0x5a, 0x1b, 0x7a, 0x99, 0xca, 0x4a, 0xa4, 0xc9,
+    0x8f, 0xd8, 0x7a, 0xbf, 0x58, 0x47, 0xb9, 0x6e, 0x28, 0x4e, 0xd4, 0x81, 0xa8, 0x23, 0x57, 0x58,
+    0xac, 0x72, 0xd4, 0xc0, 0xe0, 0xda, 0x80, 0x0b, 0x2c, 0x27, 0x0d, 0x53, 0x34, 0x58, 0x81, 0xad,
+    0xca, 0x3b, 0x43, 0x68, 0xac, 0xb2, 0x9f, 0x42, 0xbe, 0xe7, 0x25, 0xef, 0xb9, 0xc8, 0xf1, 0x34,
+    0x6d, 0x0a, 0xa8, 0x79, 0x1e, 0x25, 0x45, 0x16, 0x59, 0x34, 0x07, 0xbd, 0x83, 0x27, 0x46, 0xc5,
+    0x6e, 0x32, 0xc3, 0x39, 0xc9, 0xaf, 0x4d, 0x7c, 0xc7, 0x2e, 0x4d, 0xe9, 0x62, 0xec, 0x55, 0xe4,
+    0x5b, 0xcf, 0x87, 0xc1, 0x2e, 0xc2, 0x75, 0x1a, 0x03, 0xa4, 0x39, 0xeb, 0xe1, 0x98, 0x3a, 0x67,
+    0xc1, 0x34, 0x3a, 0x11, 0x08, 0xae, 0x40, 0x97, 0x12, 0x1e, 0xd6, 0x60, 0xf3, 0x47, 0x98, 0xb0,
+    0x97, 0x65, 0x7c, 0xf6, 0xd0, 0x19, 0x43, 0xe7, 0x4c, 0x0a, 0xeb, 0x56, 0x13, 0x58, 0x36, 0xb4,
+    0x7f, 0x12, 0xcb, 0xba, 0x8f, 0x9d, 0xc8, 0xaa, 0x4f, 0xe3, 0x64, 0xb6, 0xe5, 0x62, 0xbf, 0x6d,
+    0x79, 0x62, 0xc8, 0xcd, 0x63, 0x64, 0x7f, 0x68, 0xda, 0x5f, 0x1a, 0x7b, 0xd3, 0xa7, 0x3e, 0x32,
+    0xd3, 0xd2, 0xd0, 0xb8, 0x4a, 0x68, 0xd1, 0x6a, 0x6c, 0xed, 0x1e, 0x7a, 0x10, 0xcb, 0x70, 0x66,
+    0x74, 0xdc, 0xd6, 0x54, 0x15, 0x6c, 0x35, 0x64, 0xeb, 0x04, 0x9e, 0xb7, 0x21, 0xe1, 0x43, 0x50,
+    0x70, 0x37, 0x02, 0x2e, 0x67, 0x47, 0x26, 0xa7, 0x59, 0xaa, 0xd2, 0x7e, 0x45, 0x7a, 0x73, 0x13,
+    0x87, 0xc8, 0xfc, 0xcb, 0x75, 0x7a, 0x67, 0x40, 0xca, 0x06, 0x6b, 0x66, 0x46, 0xc8, 0x1f, 0x84,
+    0x8e, 0x3f, 0x00, 0xf1, 0x76, 0xa3, 0xdd, 0x3d, 0x48, 0xf7, 0xc3, 0x50, 0xae, 0x82, 0x70, 0x5d,
+    0x40, 0x91, 0xa3, 0x66, 0x29, 0x23, 0x8a, 0x68, 0x45, 0xb5, 0xb4, 0xae, 0xef, 0xc3, 0xd7, 0xed,
+    0xde, 0xc0, 0xa3, 0x30, 0x2f, 0xe1, 0xdd, 0xa1, 0x3d, 0x1b, 0xb1, 0xb1, 0x3d, 0x9c, 0x3e, 0x1b,
+    0xdb, 0x33, 0x8f, 0xd1, 0x0b, 0x41, 0x72, 0x00, 0xb0, 0x6c, 0xbc, 0xf0, 0x6c, 0xc0, 0x5e, 0x80,
+    0xdb, 0x6c, 0x00, 0x92, 0xae, 0x0d, 0xb0, 0x76, 0x62, 0xcf, 0x00, 0x7f, 0x06, 0x8e, 0x6f, 0x03,
+    0x9c, 0xe4, 0xaf, 0x54, 0xdc, 0xb2, 0x01, 0xea, 0xda, 0xe3, 0x51, 0x00, 0x15, 0xf9, 0xc9, 0x33,
+    0xcb, 0x76, 0xc6, 0xb6, 0xef, 0xd7, 0x09, 0x18, 0x04, 0x81, 0x14, 0xac, 0x3b, 0x99, 0x30, 0xfe,
+    0x5a, 0x66, 0xb8, 0x8e, 0xe5, 0xda, 0x9e, 0x54, 0x16, 0xaa, 0x4f, 0x66, 0x17, 0xce, 0x0c, 0x9a,
+    0x1d, 0x63, 0x97, 0xd0, 0x96, 0xc3, 0x46, 0x48, 0xd4, 0x28, 0x98, 0x60, 0xcd, 0x49, 0x55, 0x1d,
+    0x56, 0xea, 0x08, 0x66, 0x5e, 0x54, 0xc6, 0x3f, 0x1b, 0x00, 0xa7, 0xfb, 0xf3, 0x0b, 0xcf, 0x06,
+    0xac, 0x8c, 0x54, 0x4b, 0x44, 0x41, 0x59, 0x97, 0xe1, 0x4b, 0x0c, 0x43, 0x63, 0x9e, 0x3d, 0x84,
+    0xcc, 0x91, 0x3d, 0x86, 0x34, 0x7a, 0xe5, 0x85, 0x3c, 0xdb, 0x83, 0xce, 0xec, 0xa9, 0x4c, 0x0f,
+    0xb3, 0xa7, 0x17, 0xd0, 0x0d, 0x60, 0x56, 0xa8, 0x83, 0x6c, 0x60, 0xee, 0x10, 0xc9, 0x71, 0x87,
+    0xc1, 0xcc, 0x06, 0x48, 0x4c, 0x2f, 0xbc, 0xa4, 0x6f, 0x0f, 0x01, 0x69, 0xda, 0xfe, 0x08, 0xfa,
+    0x80, 0x89, 0x87, 0x17, 0x95, 0x0b, 0x40, 0xc1, 0x50, 0x19, 0x2a, 0x26, 0xfd, 0xbc, 0x19, 0xdb,
+    0x1e, 0x36, 0xe3, 0xcc, 0x62, 0xd7, 0x06, 0x90, 0x8a, 0x2f, 0xcf, 0x80, 0x65, 0x0e, 0xa3, 0x97,
+    0x6a, 0x52, 0x9c, 0x51, 0x00, 0xbd, 0x0a, 0xae, 0xbb, 0x16, 0x8c, 0x5b, 0x2b, 0x63, 0x0f, 0x27,
+    0x96, 0xed, 0xc3, 0xf8, 0xb1, 0xf0, 0x74, 0x61, 0xf1, 0x39, 0xb4, 0x70, 0x0e, 0x2d, 0xe4, 0x86,
+    0x05, 0xc4, 0x5b, 0x30, 0x85, 0x2e, 0x0e, 0x84, 0xbf, 0xf2, 0x8a, 0xae, 0x3d, 0x81, 0xc2, 0x93,
+    0xd9, 0xf3, 0xa9, 0xed, 0xc3, 0x04, 0x0d, 0x9f, 0x8d, 0xd8, 0xa8, 0x24, 0x1a, 0x7d, 0x1e, 0x7b,
+    0xe4, 0x3d, 0x87, 0x57, 0x1f, 0x6a, 0x4d, 0x9e, 0x4d, 0x70, 0x68, 0xf4, 0x52, 0x53, 0x36, 0xfd,
+    0xd9, 0xe8, 0x32, 0xb7, 0x81, 0x69, 0x0e, 0xa4, 0x4b, 0xd4, 0x7c, 0xa4, 0xd5, 0x89, 0x3a, 0x4c,
+    0x6f, 0xbb, 0xa1, 0x7b, 0x9c, 0x4d, 0x3f, 0xdc, 0x84, 0x2f, 0xd2, 0x65, 0x48, 0xf6, 0xe8, 0x6b,
+    0x8c, 0x7d, 0x1f, 0x62, 0xc2, 0xa5, 0x38, 0x4a, 0x33, 0x42, 0xa4, 0x9b, 0x62, 0x6e, 0xef, 0x29,
+    0x78, 0x87, 0x9f, 0x2c, 0xec, 0xae, 0xc7, 0xed, 0x3f, 0x7d, 0x3c, 0x37, 0xd9, 0xfa, 0x3d, 0x3c,
+    0xc1, 0x8a, 0x1f, 0x0f, 0xc1, 0x11, 0x19, 0x06, 0x83, 0x6f, 0x4a, 0x7f, 0x94, 0x0d, 0xef, 0xb0,
+    0xdd, 0x07, 0x8d, 0xf0, 0x13, 0xcc, 0xb8, 0xd2, 0xa5, 0x41, 0x3a, 0x45, 0x05, 0x69, 0x47, 0x5c,
+    0x1d, 0x04, 0x41, 0xda, 0xdd, 0xf5, 0x06, 0x4f, 0xaa, 0x14, 0x9a, 0xaa, 0xe6, 0x7c, 0xe6, 0xb9,
+    0x6a, 0x0e, 0x06, 0xf0, 0xb4, 0x70, 0xde, 0x51, 0x9b, 0xa9, 0x28, 0x43, 0x78, 0x4f, 0xf2, 0x6d,
+    0x90, 0x88, 0x79, 0x50, 0xf6, 0x5f, 0xdb, 0x24, 0x14, 0xd6, 0x1c, 0xd4, 0x50, 0x99, 0xdc, 0xf4,
+    0x5a, 0x75, 0xb4, 0xcc, 0xc7, 0xf2, 0x07, 0x38, 0xfd, 0xe4, 0x04, 0xc7, 0xd3, 0x8c, 0x80, 0x8a,
+    0xf3, 0x21, 0xd8, 0x15, 0xff, 0x58, 0x07, 0x3d, 0xb7, 0xf5, 0xbc, 0x88, 0xb3, 0x23, 0xd5, 0x98,
+    0xe4, 0x18, 0xb0, 0x1c, 0xf2, 0x0c, 0xa4, 0x21, 0x64, 0x29, 0x96, 0x8c, 0xa3, 0x44, 0x71, 0xe2,
+    0x44, 0x03, 0x62, 0xa7, 0x36, 0x4a, 0xd6, 0x61, 0x16, 0x15, 0xf3, 0xc3, 0x4f, 0x31, 0xc8, 0x6d,
+    0x11, 0xd1, 0x01, 0x3a, 0xbb, 0xf7, 0x7a, 0x37, 0xeb, 0x2c, 0x5c, 0x9d, 0xf5, 0x7e, 0x0b, 0x6e,
+    0x83, 0x7c, 0x91, 0x45, 0xdb, 0xe2, 0x54, 0x94, 0xfb, 0x11, 0x80, 0x44, 0xd1, 0x57, 0xec, 0xf1,
+    0xf9, 0x77, 0x3c, 0x8b, 0x51, 0xde, 0x93, 0x93, 0x7a, 0x0c, 0x35, 0xef, 0xb6, 0x12, 0x53, 0xf8,
+    0x5c, 0x57, 0x1c, 0x39, 0x90, 0x47, 0x6b, 0x29, 0xfe, 0xcc, 0x19, 0x2d, 0xbe, 0x71, 0xfa, 0xca,
+    0xf6, 0x41, 0x88, 0xf2, 0x82, 0x81, 0x56, 0xce, 0xd9, 0x99, 0xb2, 0xdf, 0x71, 0xca, 0xae, 0x30,
+    0x4e, 0x3d, 0xb6, 0xc7, 0x13, 0xb4, 0x94, 0xd3, 0x31, 0x98, 0x36, 0xb0, 0xbf, 0x23, 0x7b, 0xb2,
+    0xb0, 0xa7, 0x64, 0x3a, 0x3c, 0xd0, 0xff, 0x60, 0xea, 0xc0, 0x0c, 0x0c, 0x31, 0x6f, 0x6a, 0x41,
+    0xde, 0x05, 0x1a, 0xcb, 0x31, 0x99, 0x56, 0x1f, 0xed, 0xc7, 0x10, 0x20, 0x83, 0x47, 0x96, 0xc2,
+    0xcb, 0x2d, 0x9f, 0xb2, 0x20, 0x07, 0x3e, 0x79, 0x1e, 0x81, 0x83, 0xdf, 0x7b, 0x27, 0xe7, 0x04,
+    0x7f, 0x5a, 0x81, 0x0c, 0x65, 0x58, 0x62, 0x6c, 0x67, 0x3d, 0xdb, 0xeb, 0x11, 0x8c, 0x71, 0x3d,
+    0x80, 0x1e, 0x6c, 0xb2, 0xb0, 0xc0, 0x66, 0x5a, 0x60, 0xfd, 0xa1, 0xf3, 0x99, 0x67, 0x8d, 0x2c,
+    0x07, 0x21, 0x89, 0x35, 0xba, 0x00, 0x9c, 0x32, 0x65, 0x1e, 0x43, 0x1b, 0x09, 0x43, 0x20, 0x43,
+    0x3b, 0x89, 0x01, 0xfb, 0x0c, 0xa7, 0x68, 0x00, 0xfd, 0xb1, 0x61, 0x10, 0xcf, 0x45, 0x9b, 0x44,
+    0x13, 0x19, 0xaa, 0x2b, 0x69, 0x67, 0xca, 0x01, 0x86, 0x98, 0x49, 0x41, 0x03, 0x89, 0x23, 0xf6,
+    0x17, 0x43, 0xb0, 0xb6, 0x53, 0xc4, 0x1f, 0x96, 0xcf, 0x60, 0x90, 0x0b, 0xec, 0x15, 0x60, 0xc4,
+    0xc4, 0xb1, 0x87, 0x60, 0x4d, 0x01, 0x23, 0xd8, 0x8e, 0xf3, 0xfc, 0x13, 0x50, 0x1e, 0x3b, 0x80,
+    0xe9, 0xa0, 0xef, 0x91, 0xfb, 0x13, 0xd2, 0x71, 0x00, 0x53, 0x75, 0xba, 0x01, 0xd5, 0x01, 0x8d,
+    0x40, 0xd2, 0x98, 0xb0, 0xc4, 0x18, 0x40, 0x84, 0x3d, 0x73, 0xe1, 0xbb, 0x07, 0xcd, 0x3a, 0x90,
+    0x31, 0x75, 0x01, 0x28, 0xf8, 0x13, 0xfc, 0x00, 0xf8, 0x02, 0xc0, 0x85, 0x8f, 0xc8, 0x08, 0xe0,
+    0x03, 0x4c, 0x25, 0xbc, 0xcf, 0x50, 0x02, 0x00, 0x3c, 0x00, 0xc1, 0x07, 0xd0, 0xf7, 0x02, 0x91,
+    0xe4, 0xf8, 0x16, 0x11, 0xd3, 0x82, 0xb0, 0x10, 0xfc, 0x21, 0x1c, 0xf4, 0xcb, 0xbf, 0x4b, 0x07,
+    0x03, 0xab, 0xd8, 0xc3, 0x94, 0x28, 0xfc, 0xc9, 0x19, 0x03, 0x41, 0x3e, 0x02, 0x27, 0x66, 0x63,
+    0x98, 0xd6, 0xb9, 0x1d, 0x2d, 0x80, 0xb3, 0x34, 0x02, 0xfc, 0x6f, 0x0d, 0xcc, 0xf6, 0x39, 0x2a,
+    0x85, 0x14, 0xcb, 0xb9, 0xb5, 0x46, 0x38, 0x2a, 0x1f, 0xff, 0x77, 0xf0, 0xbf, 0xdf, 0x37, 0x50,
+    0x6b, 0xb8, 0xb6, 0xbc, 0xb2, 0x57, 0x7b, 0x0a, 0xc4, 0x3b, 0x58, 0xda, 0x26, 0xe8, 0x96, 0xc3,
+    0x9f, 0x3d, 0x61, 0x22, 0x05, 0x3a, 0x34, 0x8a, 0x81, 0x3b, 0x6c, 0x15, 0x83, 0x4f, 0x2d, 0x91,
+    0x7b, 0x27, 0x74, 0x03, 0xeb, 0x8f, 0xe0, 0x9d, 0xef, 0xc6, 0x3e, 0xae, 0x3f, 0x58, 0x8a, 0x23,
+    0xd3, 0x6c, 0x60, 0x26, 0x40, 0xc2, 0xa1, 0x7f, 0xe1, 0x4c, 0xed, 0xa9, 0x8f, 0x55, 0x00, 0xd4,
+    0x11, 0xde, 0x76, 0x08, 0xe1, 0x3a, 0xc3, 0x1c, 0xc0, 0xe3, 0x14, 0x11, 0xa9, 0x3b, 0x82, 0x92,
+    0x2e, 0xb6, 0xe0, 0xbb, 0x66, 0x8e, 0xfc, 0x6b, 0x2f, 0x0c, 0xc7, 0xc6, 0xa0, 0x33, 0x09, 0x27,
+    0xca, 0x39, 0x50, 0xe5, 0x41, 0x6b, 0x17, 0x50, 0x04, 0x3d, 0x08, 0xd0, 0xb4, 0x0e, 0x0a, 0xea,
+    0x6c, 0x5a, 0x71, 0x6e, 0x61, 0xa1, 0xcf, 0x80, 0xe0, 0x9b, 0x0f, 0x18, 0xb8, 0x87, 0xcc, 0x43,
+    0xa6, 0x23, 0x7a, 0x1e, 0xfa, 0xff, 0xd2, 0xeb, 0xc3, 0xfb, 0xbf, 0xbc, 0x3e, 0x3c, 0x9a, 0x43,
+    0xf0, 0x7f, 0xfd, 0x98, 0x3c, 0xcc, 0xa9, 0x3d, 0x76, 0x4c, 0xb3, 0x81, 0x99, 0x16, 0x66, 0x5e,
+    0xb8, 0x43, 0x12, 0xd0, 0x21, 0x4d, 0xf6, 0x18, 0x49, 0x43, 0x62, 0xd8, 0x34, 0x87, 0x6c, 0xc8,
+    0x70, 0x21, 0x1d, 0x3e, 0x8d, 0xd0, 0x53, 0x9e, 0xf9, 0x66, 0x86, 0xfc, 0x0b, 0x2f, 0x8f, 0x00,
+    0x28, 0x00, 0xef, 0x1c, 0x5f, 0xb8, 0x47, 0x08, 0x7e, 0xef, 0x04, 0xc8, 0x1a, 0x4f, 0x11, 0x06,
+    0xb8, 0x33, 0x60, 0xf0, 0x8c, 0xe4, 0x73, 0x36, 0x12, 0x7c, 0xc3, 0xc5, 0x81, 0x5e, 0xab, 0x89,
+    0x7d, 0xdd, 0x73, 0xf2, 0x2f, 0xb3, 0x42, 0x46, 0x02, 0x59, 0xfd, 0xd3, 0x11, 0xcc, 0xc8, 0xa9,
+    0x3b, 0x76, 0x91, 0xd1, 0xee, 0x08, 0xe5, 0xdb, 0x75, 0x19, 0xa8, 0x26, 0x94, 0x6e, 0x4f, 0x44,
+    0x5b, 0x2e, 0x11, 0xcc, 0x61, 0x22, 0x9a, 0x13, 0x2a, 0x66, 0x7b, 0x3e, 0x4e, 0x8c, 0x87, 0x7d,
+    0xcd, 0x6c, 0xc8, 0xf6, 0xe0, 0x6d, 0xe2, 0xc4, 0xa4, 0x04, 0xe1, 0xc5, 0x8b, 0x69, 0x8e, 0xe1,
+    0x05, 0x65, 0x17, 0x4a, 0x60, 0x64, 0x68, 0xe8, 0xf2, 0x77, 0x8c, 0x7d, 0xc4, 0x2e, 0x0e, 0x10,
+    0x5f, 0x7e, 0x72, 0x88, 0x75, 0x23, 0xc0, 0x82, 0x33, 0xe0, 0x20, 0x34, 0xef, 0x61, 0xdc, 0x75,
+    0x06, 0xcc, 0xc7, 0x39, 0xf4, 0x51, 0x16, 0x86, 0x38, 0x93, 0x13, 0x1c, 0xd4, 0x64, 0x42, 0x9f,
+    0xd6, 0x20, 0x1f, 0xa3, 0x18, 0x8b, 0x89, 0xb2, 0x88, 0x54, 0x40, 0x19, 0x23, 0xfb, 0x87, 0x53,
+    0x0b, 0x21, 0x0b, 0xf4, 0x73, 0xa0, 0x1a, 0x78, 0xe1, 0xba, 0x5c, 0x74, 0x48, 0x70, 0x30, 0x8c,
+    0x85, 0x31, 0x15, 0xcb, 0xcd, 0x2d, 0x97, 0xe1, 0x67, 0xe6, 0xde, 0x3a, 0x28, 0x2a, 0x42, 0x56,
+    0x46, 0x5c, 0x58, 0x3c, 0x12, 0x16, 0x1f, 0xc3, 0x34, 0x5c, 0x5c, 0xc0, 0xb2, 0xfa, 0x42, 0x5e,
+    0x46, 0x42, 0x60, 0x3c, 0x12, 0x18, 0x9f, 0x26, 0x54, 0x11, 0x19, 0x97, 0xf7, 0xc6, 0xeb, 0x63,
+    0x73, 0x96, 0x93, 0x53, 0xd3, 0xd8, 0xd2, 0xad, 0x63, 0x98, 0xae, 0x87, 0xf9, 0x91, 0x02, 0xd0,
+    0x31, 0x08, 0x98, 0x6e, 0xc3, 0x04, 0x40, 0xfa, 0xd5, 0x0b, 0xd7, 0xc1, 0x25, 0x87, 0x72, 0x62,
+    0x0e, 0x97, 0xe5, 0x16, 0x05, 0xab, 0x50, 0x8b, 0xcd, 0xb0, 0xe4, 0xc4, 0x1e, 0x1f, 0x16, 0xd7,
+    0xca, 0x31, 0x4e, 0x84, 0xf5, 0x18, 0xd6, 0xb3, 0xb4, 0x7a, 0x30, 0x5d, 0x72, 0x84, 0x69, 0xd2,
+    0x8c, 0x30, 0x81, 0xcc, 0x4e, 0x3d, 0x14, 0x19, 0x94, 0x1b, 0xf8, 0x34, 0xa6, 0x90, 0x62, 0xae,
+    0xc4, 0x12, 0x19, 0xac, 0x43, 0x07, 0x25, 0x08, 0x63, 0x75, 0xe8, 0x32, 0x40, 0x31, 0xa2, 0x77,
+    0xfc, 0xf3, 0x06, 0x18, 0x3e, 0x0c, 0x78, 0x08, 0x0a, 0x7b, 0x85, 0x4f, 0x41, 0x15, 0x90, 0x82,
+    0x95, 0x31, 0x82, 0x12, 0x6c, 0x2c, 0x62, 0x61, 0x48, 0x18, 0xc6, 0xc2, 0xa4, 0xc8, 0x18, 0x73,
+    0x7f, 0xbe, 0x9a, 0x37, 0xd8, 0xb6, 0x88, 0xd3, 0x3c, 0x24, 0xbe, 0xfd, 0x3b, 0xf4, 0xf9, 0xef,
+    0xd0, 0xe7, 0xc7, 0x0c, 0x7d, 0x5e, 0x69, 0x8b, 0x94, 0xdf, 0x4e, 0x72, 0xc6, 0x96, 0xe9, 0x62,
+    0xb7, 0x09, 0x93, 0xc2, 0xbe, 0x09, 0x8b, 0x6f, 0xe3, 0x10, 0x3f, 0x7e, 0x7d, 0xff, 0xfd, 0xb2,
+    0x2f, 0xef, 0xc0, 0x0f, 0x54, 0x41, 0xa5, 0xf3, 0x5e, 0x1d, 0x35, 0x95, 0x18, 0x91, 0x56, 0x17,
+    0x63, 0x62, 0xaf, 0xe3, 0x28, 0x2f, 0x42, 0x7c, 0xd4, 0xad, 0xa3, 0x11, 0x0a, 0xdc, 0x69, 0x95,
+    0x71, 0x5b, 0xf4, 0xa0, 0xca, 0xb4, 0x61, 0xab, 0x55, 0x2e, 0x63, 0xb0, 0x07, 0x35, 0x50, 0xed,
+    0x13, 0x6a, 0x8d, 0x64, 0xe9, 0x1d, 0xc6, 0x1e, 0x92, 0xf0, 0x8e, 0xbd, 0x08, 0xb6, 0xfd, 0x2a,
+    0x37, 0x0e, 0x0b, 0x3c, 0xbf, 0x99, 0xfc, 0x14, 0x66, 0x39, 0x3e, 0x48, 0x77, 0x56, 0x1f, 0x30,
+    0xc5, 0x2c, 0xfe, 0x30, 0x2d, 0x56, 0xdc, 0xc5, 0xb1, 0x9c, 0x11, 0x07, 0x79, 0x71, 0x59, 0x04,
+    0xc5, 0xce, 0x94, 0x99, 0x26, 0x5a, 0xd6, 0x51, 0x1d, 0x89, 0xb3, 0x83, 0xe5, 0xf2, 0x5b, 0x6c,
+    0xf5, 0xb9, 0x18, 0x4d, 0xbf, 0x0c, 0xda, 0x1d, 0x33, 0xfe, 0xe1, 0x3b, 0x28, 0x25, 0x51, 0x2f,
+    0xb1, 0xdd, 0x50, 0x97, 0xc7, 0x41, 0x8f, 0xd9, 0x6e, 0xbb, 0x0c, 0x8a, 0xf0, 0x27, 0x3c, 0x6b,
+    0x50, 0xd5, 0x55, 0xb8, 0xfe, 0xc8, 0xba, 0x0d, 0xa6, 0x1f, 0x5c, 0xff, 0xa8, 0xdc, 0x19, 0x4b,
+    0x96, 0xe9, 0x9d, 0xa1, 0xd6, 0x37, 0x3f, 0xbc, 0xb8, 0xe0, 0xa7, 0xf3, 0x9f, 0xa7, 0xc1, 0x32,
+    0x5c, 0x42, 0x03, 0x7d, 0x62, 0xf3, 0x80, 0x9d, 0x9d, 0xcb, 0x27, 0xfc, 0xdb, 0xa6, 0x58, 0x3b,
+    0x86, 0x3a, 0xb0, 0xe9, 0xe9, 0xcb, 0xbf, 0xbc, 0x7a, 0xf1, 0x1c, 0xf8, 0x4d, 0x07, 0x45, 0x5f,
+    0x63, 0x91, 0xf9, 0xfe, 0x96, 0xea, 0xb3, 0xaa, 0x03, 0x7a, 0x12, 0x4e, 0xd0, 0x55, 0x35, 0x83,
+    0x69, 0x07, 0x36, 0x53, 0x9d, 0x51, 0x35, 0xb7, 0x04, 0xd9, 0xd2, 0xa3, 0x5c, 0x20, 0x22, 0x78,
+    0x26, 0xf5, 0x65, 0x90, 0x05, 0x37, 0x59, 0xb0, 0x5d, 0x77, 0x09, 0x74, 0x7d, 0x78, 0x55, 0x3a,
+    0x53, 0xac, 0xd4, 0x36, 0x76, 0x88, 0x25, 0xe6, 0x47, 0x4a, 0x97, 0x28, 0x4a, 0xdf, 0xd3, 0x83,
+    0x99, 0x07, 0xaf, 0x5e, 0x56, 0x57, 0xb2, 0xf3, 0xb0, 0x78, 0x56, 0x14, 0x59, 0x74, 0xbd, 0x2b,
+    0xc2, 0x7e, 0x6f, 0x13, 0xbc, 0x8b, 0xc3, 0xe4, 0xa6, 0x58, 0xc3, 0xf4, 0x91, 0x1c, 0xbc, 0xc6,
+    0xaf, 0xeb, 0xc2, 0x58, 0x55, 0x8a, 0xcb, 0x43, 0xdf, 0xbc, 0x38, 0x46, 0xff, 0x0f, 0x65, 0xb0,
+    0xb4, 0x77, 0xa1, 0xb3, 0xb7, 0xd1, 0xd8, 0xfe, 0xd6, 0xea, 0x98, 0xa6, 0xde, 0x18, 0x8f, 0x60,
+    0xea, 0x0d, 0x45, 0x2b, 0xd6, 0xff, 0x0c, 0xb7, 0x6a, 0x8b, 0xd7, 0xf9, 0x3a, 0xbd, 0x53, 0x2f,
+    0xb0, 0x10, 0xda, 0x05, 0x73, 0x9f, 0x47, 0xc9, 0x9b, 0x2e, 0xd6, 0xca, 0x31, 0x5d, 0xe5, 0xb6,
+    0x84, 0xaa, 0xb6, 0x4d, 0x31, 0x56, 0x5b, 0x84, 0xd6, 0xa1, 0xad, 0x1e, 0x05, 0xd7, 0x0d, 0x87,
+    0xba, 0x0f, 0x58, 0x67, 0x78, 0xe0, 0xb4, 0x6d, 0x6d, 0xd1, 0x90, 0x10, 0xe9, 0x51, 0x9d, 0xbc,
+    0x3f, 0x18, 0x30, 0xe9, 0x7c, 0x6a, 0xb3, 0x93, 0xd5, 0x2e, 0xa1, 0xbb, 0xb8, 0xe4, 0xa5, 0xde,
+    0x57, 0x6e, 0x64, 0x42, 0xce, 0x7c, 0x8b, 0x71, 0xfb, 0x7e, 0x68, 0x17, 0x41, 0x06, 0x63, 0xb7,
+    0xa3, 0xe5, 0x31, 0xeb, 0x01, 0x05, 0xab, 0x20, 0xce, 0xc3, 0xe6, 0xf3, 0xa2, 0x55, 0x9b, 0x51,
+    0x4e, 0x67, 0x9e, 0x2e, 0xf8, 0x6d, 0x0b, 0x7d, 0xb9, 0xd5, 0x2c, 0x2c, 0x76, 0x59, 0xc2, 0x9e,
+    0xe1, 0x93, 0x0b, 0xf6, 0x2a, 0x4b, 0x37, 0x7d, 0xf9, 0x6e, 0xa1, 0x92, 0xd1, 0x6f, 0x77, 0x61,
+    0x76, 0x7f, 0x29, 0x0e, 0x88, 0x3d, 0x8b, 0xe3, 0xfe, 0x57, 0x86, 0xdb, 0x1c, 0xbe, 0x1a, 0x54,
+    0x55, 0x07, 0x76, 0x9e, 0x6e, 0xc2, 0x7e, 0x9f, 0x72, 0x88, 0x33, 0xf4, 0xc9, 0x2e, 0x6f, 0x61,
+    0x69, 0x27, 0xb5, 0x1e, 0x25, 0x4a, 0xdc, 0x31, 0x13, 0x7b, 0x14, 0xa0, 0xb9, 0xf1, 0x49, 0xa6,
+    0x81, 0xfa, 0x58, 0x1a, 0xc8, 0x05, 0x3d, 0xd0, 0xc2, 0xce, 0x8e, 0xd4, 0x4d, 0x2f, 0xbb, 0x48,
+    0x9f, 0xa7, 0x77, 0x61, 0x76, 0x11, 0xe4, 0x21, 0x0c, 0xf7, 0xec, 0x0c, 0x26, 0xda, 0xb4, 0x71,
+    0xf3, 0x94, 0xac, 0x87, 0x92, 0x74, 0xda, 0x2a, 0x5e, 0x57, 0x7c, 0xd7, 0xe4, 0x8b, 0xf7, 0xd8,
+    0xc3, 0x03, 0xdf, 0x9f, 0xbb, 0x52, 0x56, 0x23, 0x12, 0x24, 0x08, 0xc6, 0x8a, 0x1d, 0xa2, 0xaa,
+    0xb5, 0x25, 0x2a, 0x5d, 0x0d, 0xb4, 0x45, 0x41, 0xa3, 0x1b, 0xf0, 0x41, 0xda, 0xb4, 0x61, 0x80,
+    0xd2, 0x67, 0xf3, 0x53, 0x1c, 0x7d, 0xbe, 0x8d, 0xd3, 0x2b, 0x79, 0x33, 0x57, 0xaa, 0x4a, 0x74,
+    0x0c, 0x64, 0xa2, 0xb4, 0x05, 0x49, 0x55, 0x81, 0x0f, 0xe5, 0xa3, 0xb5, 0xf2, 0x53, 0x7e, 0xcd,
+    0xd9, 0xa1, 0x75, 0x44, 0xd3, 0x93, 0x2b, 0x52, 0xf4, 0x4b, 0x6d, 0x61, 0xb9, 0x7e, 0x83, 0xf7,
+    0x0a, 0x27, 0xc0, 0x67, 0x02, 0x1d, 0xbf, 0xda, 0x60, 0x9d, 0xbf, 0x0d, 0x16, 0xeb, 0x7e, 0x7f,
+    0x15, 0x85, 0xf1, 0x52, 0x5b, 0x31, 0xb2, 0x84, 0x53, 0xbe, 0x49, 0xb6, 0xf9, 0x9a, 0x69, 0x23,
+    0xaf, 0xde, 0x49, 0xbb, 0xa4, 0xe7, 0xde, 0x5a, 0x64, 0x86, 0x9e, 0xbd, 0xeb, 0xd4, 0xd0, 0xea,
+    0x86, 0x5c, 0x63, 0x8e, 0xf9, 0x60, 0xbf, 0x2e, 0x92, 0x4e, 0xa0, 0x55, 0x6f, 0x23, 0x0e, 0x1a,
+    0xba, 0x0e, 0x29, 0xf8, 0xc7, 0x3f, 0xd8, 0x67, 0x55, 0x4b, 0xaa, 0xce, 0xe3, 0xab, 0xd2, 0xf8,
+    0x94, 0x8c, 0x10, 0x7b, 0xda, 0xf8, 0x7b, 0xf5, 0x4e, 0x9e, 0xc2, 0xde, 0x45, 0x45, 0x77, 0x0f,
+    0xe7, 0x51, 0x7c, 0xed, 0xcd, 0x0d, 0xc3, 0xff, 0x29, 0xca, 0x23, 0xb9, 0x2a, 0x55, 0xd0, 0x54,
+    0x61, 0x45, 0x9b, 0x62, 0xfe, 0xaf, 0xbe, 0x78, 0x5f, 0x75, 0xfe, 0x70, 0xf8, 0x26, 0xe6, 0x17,
+    0xef, 0xcb, 0x6e, 0x1f, 0xe6, 0x3d, 0x56, 0x6e, 0x66, 0x5e, 0x99, 0x7a, 0xab, 0xae, 0x65, 0x11,
+    0xf4, 0x75, 0x28, 0x8b, 0x0a, 0xcd, 0x95, 0x3a, 0xb8, 0x66, 0x22, 0x25, 0xd8, 0xdb, 0x8c, 0xde,
+    0xbf, 0x09, 0x57, 0xc1, 0x2e, 0x2e, 0xfa, 0xf2, 0x44, 0x70, 0x66, 0xdc, 0x06, 0x71, 0xb4, 0xa4,
+    0x27, 0xb0, 0x10, 0x4b, 0xfe, 0x22, 0xcd, 0x41, 0xe3, 0x86, 0xb0, 0xa5, 0x38, 0x3b, 0xf6, 0x99,
+    0xae, 0x4e, 0xd5, 0x6b, 0xb8, 0x48, 0x76, 0x4f, 0x2b, 0x7d, 0xa3, 0x66, 0x8a, 0x65, 0x06, 0xd9,
+    0x5c, 0x9b, 0x96, 0x87, 0x4b, 0x95, 0x62, 0x0f, 0xc7, 0x87, 0x90, 0x11, 0xe5, 0x17, 0xb0, 0xd2,
+    0x90, 0xa3, 0xc0, 0xac, 0x36, 0x22, 0xf8, 0x62, 0x34, 0x93, 0xd0, 0xef, 0x37, 0x56, 0x60, 0x25,
+    0xa0, 0x2a, 0x28, 0xa6, 0x03, 0xb6, 0xa6, 0x9b, 0xb1, 0x84, 0xf5, 0x00, 0x99, 0xd0, 0x50, 0xc2,
+    0x03, 0x90, 0x07, 0xb9, 0x6f, 0x77, 0x51, 0x16, 0x2e, 0xaf, 0xba, 0xef, 0xc9, 0xe2, 0x5d, 0x1a,
+    0x7a, 0xb4, 0x39, 0xfe, 0x61, 0xe7, 0x2a, 0xfe, 0x79, 0x1c, 0x1d, 0xe0, 0x79, 0xb0, 0xeb, 0x10,
+    0xcc, 0x2a, 0x3e, 0x34, 0x53, 0xe6, 0xf3, 0x96, 0x20, 0x73, 0x0d, 0x10, 0x6f, 0x01, 0x88, 0x24,
+    0x6f, 0xd0, 0xd8, 0x20, 0x52, 0xff, 0x2e, 0xfa, 0x94, 0x3d, 0x93, 0x52, 0x43, 0xa9, 0xb3, 0x71,
+    0xe8, 0x74, 0x5e, 0x82, 0x92, 0xac, 0xa6, 0x93, 0x7d, 0xf9, 0x25, 0x68, 0x07, 0xc5, 0xbd, 0x20,
+    0x9e, 0xb4, 0xc8, 0x1a, 0xea, 0xd7, 0x56, 0x49, 0x03, 0xcc, 0x21, 0x4f, 0xc7, 0xe3, 0x65, 0x4d,
+    0x9f, 0xae, 0xbc, 0x3c, 0xbd, 0xa9, 0x92, 0x1b, 0xe5, 0xfc, 0xc4, 0xb4, 0xf8, 0xda, 0x74, 0x70,
+    0x3a, 0x46, 0x50, 0x5b, 0x8b, 0x96, 0x51, 0x94, 0x5d, 0x1e, 0x32, 0x92, 0x5f, 0x35, 0x5c, 0xbe,
+    0x0e, 0x72, 0x6e, 0xb4, 0x10, 0x81, 0xa2, 0x3d, 0x91, 0xf2, 0x25, 0x05, 0x50, 0xdb, 0xa7, 0xf7,
+    0xf5, 0xe0, 0x8f, 0x99, 0x30, 0x46, 0xa5, 0x85, 0x7c, 0x68, 0xac, 0x1a, 0x2e, 0xbe, 0xa2, 0x3c,
+    0x0e, 0x5d, 0x14, 0xd5, 0x25, 0xb5, 0x61, 0xdf, 0x2a, 0x70, 0x53, 0x64, 0x3b, 0xfd, 0x0a, 0x3d,
+    0x99, 0x66, 0xcc, 0x6e, 0xb9, 0xc4, 0x4b, 0x37, 0x2d, 0x55, 0xb5, 0x41, 0x65, 0x44, 0x8e, 0x14,
+    0x14, 0x5c, 0x5a, 0x6f, 0xc5, 0x2a, 0x28, 0x56, 0x53, 0x23, 0x46, 0xa8, 0x63, 0xd2, 0xb2, 0x22,
+    0x4b, 0x61, 0xee, 0x36, 0xb8, 0x47, 0x64, 0x8b, 0xc7, 0x0e, 0x1e, 0x34, 0x62, 0x6a, 0x81, 0x50,
+    0x59, 0x21, 0xaa, 0xd8, 0x74, 0x01, 0xd6, 0x19, 0x33, 0x88, 0xb9, 0x64, 0xfa, 0x58, 0x08, 0x13,
+    0xd6, 0x55, 0xdd, 0x8c, 0x52, 0xfb, 0x0a, 0x37, 0x05, 0x5e, 0x95, 0x9e, 0x21, 0xa8, 0x2e, 0x1f,
+    0xfb, 0x4a, 0x2a, 0x38, 0x78, 0xda, 0xe8, 0x5e, 0x1d, 0x11, 0x0c, 0xe9, 0xd9, 0xae, 0x58, 0x83,
+    0x84, 0x83, 0xf5, 0x96, 0x87, 0x07, 0xb3, 0xde, 0x22, 0xef, 0xe6, 0xa1, 0x57, 0x17, 0xcd, 0x9c,
+    0xb5, 0xd5, 0x6b, 0xa5, 0x41, 0x53, 0xfc, 0xe6, 0xf6, 0x51, 0x9d, 0x42, 0xdb, 0x06, 0xad, 0x6a,
+    0x6c, 0x77, 0x15, 0x16, 0x20, 0xf7, 0xbd, 0x13, 0x90, 0x85, 0x55, 0x74, 0xb3, 0xcb, 0x10, 0xc1,
+    0xc9, 0xcd, 0x6e, 0xc2, 0x62, 0x9d, 0xe2, 0x3a, 0x7d, 0xf9, 0xc3, 0xe5, 0x2b, 0x65, 0xd9, 0xf1,
+    0x47, 0x13, 0xf3, 0x53, 0xf6, 0x9e, 0x10, 0x07, 0xc2, 0x4a, 0xeb, 0x15, 0xb8, 0x05, 0x3d, 0x28,
+    0x0c, 0x6e, 0x7b, 0x1c, 0x2d, 0x68, 0x71, 0x9d, 0xfc, 0x96, 0xa7, 0x49, 0x4f, 0x55, 0x37, 0x18,
+    0x40, 0x3b, 0x65, 0xff, 0x75, 0xf9, 0xc3, 0x5f, 0xc1, 0x2d, 0x43, 0x78, 0x10, 0xad, 0xee, 0xfb,
+    0x62, 0x00, 0x92, 0x06, 0x7d, 0x18, 0x48, 0x75, 0xec, 0x62, 0x0d, 0x0c, 0xef, 0x83, 0x28, 0x6f,
+    0x61, 0xc5, 0x86, 0x06, 0x0b, 0x56, 0x3a, 0x93, 0x94, 0x6f, 0xa7, 0x00, 0x9f, 0x8b, 0x75, 0x96,
+    0xde, 0x51, 0x60, 0x8a, 0xaf, 0xbe, 0xde, 0x77, 0x41, 0x84, 0xf8, 0x02, 0x0c, 0x82, 0x90, 0xfd,
+    0x9e, 0xb6, 0xf8, 0x84, 0x6e, 0xaf, 0x5a, 0x41, 0xe2, 0xfb, 0xea, 0xfd, 0x7b, 0x06, 0xa2, 0xb0,
+    0xd4, 0x8f, 0x32, 0x61, 0x77, 0x01, 0xa1, 0x93, 0x12, 0x97, 0x41, 0x1b, 0x72, 0x11, 0xfb, 0xb7,
+    0xf4, 0x7a, 0x70, 0x48, 0x33, 0xcd, 0xf1, 0x29, 0xcd, 0xe4, 0xbb, 0x05, 0x1e, 0x64, 0x6b, 0xda,
+    0x45, 0x8a, 0x98, 0x97, 0xfe, 0xa7, 0x6e, 0xdf, 0x44, 0xad, 0x97, 0xa0, 0x7f, 0xfa, 0xf2, 0x82,
+    0x6a, 0x14, 0xac, 0x45, 0x63, 0xb3, 0x85, 0xf5, 0x4e, 0x92, 0xa1, 0xc9, 0x03, 0x70, 0xc3, 0x86,
+    0x69, 0x46, 0xcd, 0xc9, 0x09, 0x7e, 0xd0, 0xaf, 0x8a, 0x6c, 0x2e, 0x62, 0xe3, 0x50, 0xb2, 0x30,
+    0xc8, 0x31, 0x44, 0x88, 0xfe, 0x1a, 0x0f, 0x46, 0x18, 0x8c, 0x7d, 0xad, 0x46, 0x4b, 0x5f, 0xe3,
+    0xea, 0xfb, 0x84, 0xd4, 0x38, 0x6b, 0xda, 0xff, 0x2b, 0xa3, 0x72, 0xad, 0x28, 0x42, 0x0a, 0x1a,
+    0x1d, 0xb4, 0x92, 0x44, 0x8a, 0x03, 0x96, 0xba, 0xe1, 0x69, 0x00, 0x6d, 0x55, 0x1b, 0xca, 0x48,
+    0xe6, 0x51, 0xcb, 0xdb, 0x33, 0x48, 0xd9, 0x91, 0x2a, 0x07, 0x2a, 0xa5, 0x75, 0x0d, 0xaf, 0xab,
+    0x5d, 0xc3, 0x79, 0x5f, 0x33, 0x66, 0xe5, 0xff, 0xae, 0x2e, 0xd2, 0x5d, 0xbc, 0x4c, 0xbe, 0x2a,
+    0xca, 0x35, 0xc3, 0xf1, 0x94, 0x2c, 0x3a, 0x0f, 0x57, 0xa6, 0x8a, 0x48, 0x5f, 0x23, 0xf9, 0x31,
+    0x57, 0xa7, 0x2a, 0x4b, 0x44, 0x16, 0x33, 0x89, 0x47, 0xb5, 0xfb, 0x49, 0x09, 0x4c, 0x72, 0x06,
+    0xc9, 0x6d, 0x05, 0xd3, 0x90, 0x17, 0x25, 0xb3, 0x94, 0x06, 0x57, 0x51, 0x12, 0xc4, 0xf1, 0xbd,
+    0x11, 0x0c, 0xeb, 0x96, 0x51, 0xf7, 0x45, 0x75, 0xf3, 0xd8, 0xcc, 0xef, 0xf2, 0x56, 0x0d, 0xda,
+    0x01, 0x14, 0x42, 0x33, 0x36, 0x83, 0x8a, 0xeb, 0x65, 0x96, 0x6e, 0xa2, 0x3c, 0x24, 0xc5, 0x97,
+    0xc6, 0xb7, 0x00, 0x19, 0xb2, 0xf0, 0x37, 0xa8, 0xd5, 0x20, 0x1a, 0x2d, 0xf2, 0x12, 0xfc, 0xb8,
+    0x1a, 0xe9, 0xe8, 0x91, 0x34, 0xbc, 0x9b, 0x26, 0xc7, 0x80, 0x28, 0xb9, 0xc7, 0xbb, 0xbc, 0x45,
+    0xc5, 0x50, 0x23, 0xe4, 0xa2, 0xf2, 0x40, 0x3b, 0x7c, 0xe4, 0x9f, 0x50, 0x6d, 0xb1, 0xcf, 0x60,
+    0x39, 0x10, 0xb5, 0xba, 0xa7, 0x5a, 0x56, 0x17, 0x65, 0xb9, 0x83, 0x49, 0x8b, 0xe7, 0x16, 0xaf,
+    0xd8, 0x8f, 0x00, 0xb4, 0x49, 0x4d, 0x49, 0xd9, 0x2b, 0xd2, 0xc9, 0x86, 0x05, 0x2f, 0x46, 0xa3,
+    0x63, 0x20, 0xfe, 0x58, 0x8b, 0x71, 0x83, 0x40, 0xc2, 0x3b, 0xc8, 0xab, 0x72, 0x9c, 0x1d, 0x37,
+    0xd0, 0x36, 0xb9, 0xb4, 0x4d, 0xe3, 0x18, 0x79, 0xd4, 0xc1, 0x1d, 0xf3, 0xe0, 0x4f, 0x4e, 0x98,
+    0x20, 0x4a, 0xec, 0x6c, 0x00, 0xe6, 0x2a, 0xe2, 0x10, 0x8c, 0x50, 0xc8, 0x82, 0xa2, 0x08, 0x37,
+    0xdb, 0x82, 0xdd, 0xad, 0x23, 0x91, 0x02, 0x76, 0x2f, 0x0c, 0x36, 0x88, 0x69, 0x31, 0x56, 0xd8,
+    0xe8, 0x46, 0x34, 0x01, 0xe0, 0x82, 0x7f, 0x42, 0x6d, 0xb4, 0xbc, 0xbf, 0xac, 0xb8, 0x46, 0xca,
+    0xfd, 0x32, 0xdd, 0x65, 0x8b, 0xd0, 0xfe, 0xe1, 0xe5, 0xb7, 0x7f, 0x6d, 0x72, 0x0f, 0x7a, 0x7f,
+    0x15, 0x6d, 0xc2, 0x74, 0x57, 0xf4, 0x71, 0x48, 0xc7, 0x0c, 0x1f, 0xcf, 0x19, 0xcc, 0x8d, 0xbe,
+    0x4c, 0xd7, 0xf5, 0xbe, 0xdc, 0x0a, 0x5c, 0x9d, 0x70, 0x5e, 0x3e, 0x85, 0xb9, 0x3f, 0xfb, 0xe2,
+    0x3d, 0xbc, 0x3e, 0x5c, 0xe9, 0xda, 0x6c, 0xbf, 0x85, 0x7e, 0xb4, 0x95, 0xbe, 0xc1, 0x2d, 0x24,
+    0xea, 0xb8, 0x37, 0x98, 0xb7, 0x39, 0x7f, 0x1d, 0xc6, 0xba, 0xa1, 0x46, 0x24, 0x3a, 0x5b, 0x17,
+    0x01, 0xf7, 0x4e, 0x70, 0xad, 0x98, 0x05, 0xc8, 0xc8, 0x5d, 0xdf, 0xc0, 0xdc, 0x66, 0xcf, 0x42,
+    0x89, 0x51, 0xf8, 0xae, 0xa5, 0xe7, 0x0e, 0xa9, 0xdf, 0x2b, 0xf7, 0x4c, 0x28, 0x07, 0xd1, 0x41,
+    0x93, 0x9e, 0x79, 0x9b, 0xec, 0x4b, 0x0d, 0xf3, 0xa1, 0xcb, 0x99, 0x82, 0x19, 0xf5, 0xbe, 0xdc,
+    0x40, 0xbd, 0x66, 0x3e, 0x8e, 0xfb, 0x07, 0xc6, 0xe9, 0x64, 0xec, 0x41, 0xe0, 0x1f, 0x4d, 0x75,
+    0x33, 0x4e, 0x47, 0x97, 0xdd, 0x76, 0x44, 0xd8, 0xea, 0xcb, 0x37, 0x64, 0x6f, 0x06, 0xbe, 0x2b,
+    0x01, 0x2b, 0xf9, 0xd6, 0xb2, 0x46, 0xe6, 0xd5, 0x91, 0xe1, 0x71, 0x02, 0x71, 0x17, 0x96, 0xfa,
+    0x30, 0x41, 0x7e, 0x7b, 0x53, 0x1d, 0xd9, 0x2e, 0xef, 0x0b, 0xea, 0x1d, 0xf0, 0x14, 0x1c, 0x3d,
+    0x4d, 0xf6, 0x75, 0xf9, 0x34, 0x99, 0xef, 0xc2, 0xff, 0xbd, 0x73, 0xf6, 0x44, 0xdc, 0x7a, 0xa5,
+    0xb7, 0x58, 0x5e, 0x87, 0xd5, 0x63, 0x0b, 0xa8, 0xe1, 0x8e, 0xe1, 0xfd, 0x9e, 0xbf, 0x67, 0xf0,
+    0xe6, 0xf7, 0xc4, 0x89, 0x18, 0x8a, 0xd4, 0x9d, 0x9c, 0xf3, 0x27, 0xce, 0x4c, 0x8d, 0xe0, 0x47,
+    0xa5, 0x30, 0x3f, 0xf1, 0x85, 0x67, 0x01, 0xdc, 0x89, 0xed, 0xc6, 0x13, 0xf8, 0x80, 0x27, 0x1a,
+    0x9d, 0x31, 0x9e, 0x7d, 0x1a, 0xdb, 0xd3, 0xea, 0xe8, 0xca, 0x91, 0xf1, 0x71, 0x8b, 0x96, 0xe7,
+    0x6b, 0xf4, 0xa7, 0x0f, 0xe9, 0xfe, 0x3d, 0x99, 0x6f, 0x78, 0x67, 0x8d, 0x72, 0x72, 0xbf, 0xbc,
+    0x45, 0x87, 0x1e, 0xf9, 0xa1, 0x9b, 0x5c, 0x94, 0x0b, 0x5d, 0x7a, 0xe7, 0x97, 0x5c, 0x36, 0xe4,
+    0x9b, 0x6a, 0xf8, 0xf1, 0xf9, 0xc7, 0x34, 0x53, 0x5f, 0x09, 0xe8, 0xd0, 0xe5, 0x35, 0x73, 0xf3,
+    0x0f, 0x85, 0x94, 0xbd, 0xad, 0x60, 0x11, 0xdd, 0x97, 0xd6, 0x9e, 0x54, 0x8e, 0xfa, 0x90, 0xfb,
+    0x23, 0x7b, 0x6f, 0x5c, 0xdf, 0xd7, 0x3b, 0xff, 0xe2, 0x7d, 0x25, 0xe7, 0x0f, 0x6d, 0x6d, 0x2b,
+    0xf7, 0xe3, 0x60, 0x95, 0x1a, 0xc1, 0xbc, 0x16, 0x2b, 0x06, 0x08, 0x7d, 0x54, 0x1b, 0x7f, 0x4f,
+    0x77, 0x14, 0x00, 0xe3, 0x67, 0x67, 0xd0, 0xe0, 0xf0, 0xcd, 0x2c, 0xb9, 0xba, 0x3a, 0xd1, 0x57,
+    0xed, 0xab, 0xb6, 0x7c, 0x72, 0x3e, 0xe4, 0x6b, 0x50, 0x45, 0x2a, 0x4a, 0x64, 0x41, 0x5b, 0xc7,
+    0x25, 0xf0, 0x2d, 0x9f, 0x82, 0x3e, 0x63, 0xa2, 0x09, 0x1b, 0xfd, 0x77, 0x34, 0xfe, 0xa6, 0xc7,
+    0xff, 0x5b, 0x62, 0x09, 0xa2, 0x11, 0xe3, 0x1e, 0x21, 0xdd, 0x46, 0xd3, 0x1a, 0x11, 0xc0, 0x7d,
+    0xab, 0xbd, 0x41, 0x01, 0xbc, 0x47, 0xff, 0x73, 0x03, 0x39, 0x03, 0x25, 0x4c, 0xa0, 0xec, 0x2d,
+    0x52, 0xaf, 0x75, 0xec, 0xa8, 0xde, 0xf3, 0xea, 0x2b, 0x9b, 0x5e, 0x25, 0x22, 0x93, 0xef, 0x71,
+    0x37, 0xc0, 0xf4, 0x56, 0x6d, 0x67, 0xe2, 0xd1, 0x40, 0x6f, 0xdc, 0xe8, 0xdc, 0x23, 0x4e, 0xc6,
+    0xe1, 0x7d, 0x87, 0x51, 0xa7, 0x06, 0x23, 0xe7, 0x4a, 0xb9, 0xd2, 0xb1, 0x30, 0x96, 0x45, 0xe4,
+    0x56, 0x4e, 0xdd, 0x32, 0x28, 0x02, 0x98, 0x74, 0x3b, 0xd8, 0x51, 0x84, 0x76, 0xd8, 0xa1, 0xee,
+    0x65, 0x88, 0xdc, 0xd8, 0x92, 0x91, 0x76, 0x1e, 0xe9, 0xf0, 0x86, 0x68, 0x3f, 0x1f, 0xd4, 0x1c,
+    0x0d, 0x63, 0xce, 0xce, 0x30, 0x6e, 0xec, 0x0d, 0x0c, 0x9a, 0x81, 0x2a, 0xdc, 0xe6, 0xcd, 0xfb,
+    0xea, 0x96, 0x98, 0x69, 0x27, 0x8b, 0xee, 0xe7, 0xb9, 0xdc, 0x46, 0x49, 0x93, 0xa6, 0x72, 0x0e,
+    0x64, 0x3f, 0x41, 0x9f, 0x0e, 0xe5, 0x82, 0x1f, 0xd5, 0x45, 0x69, 0xec, 0xd3, 0x49, 0x57, 0x58,
+    0x37, 0x76, 0xeb, 0x9a, 0xa4, 0xd5, 0xfb, 0xc4, 0xea, 0x6d, 0x8c, 0x7a, 0x14, 0xae, 0x5e, 0x7c,
+    0xf5, 0x50, 0x1a, 0x59, 0xe6, 0x75, 0xc9, 0xd1, 0x9c, 0x7c, 0x2a, 0xe7, 0x29, 0xbb, 0x3a, 0xe1,
+    0x5b, 0xcf, 0x4f, 0xf3, 0x28, 0x59, 0x84, 0x80, 0xee, 0xa4, 0xec, 0x87, 0x2b, 0xdc, 0x1f, 0x12,
+    0x05, 0x7a, 0x1f, 0x3d, 0x1e, 0x53, 0x8a, 0x57, 0x59, 0x0a, 0x5c, 0xa3, 0x1c, 0xaf, 0xe0, 0x67,
+    0xe9, 0x9b, 0x4f, 0x14, 0x99, 0x51, 0x49, 0xc4, 0x38, 0xd5, 0xfd, 0xff, 0xd0, 0xe0, 0xd4, 0xa2,
+    0xf3, 0x3d, 0x91, 0x17, 0xe0, 0x50, 0x82, 0x5b, 0x79, 0x18, 0xee, 0xc6, 0xf3, 0x4f, 0x36, 0xda,
+    0x1c, 0xfa, 0xc6, 0xf1, 0x7a, 0x27, 0x1e, 0x2f, 0xe7, 0xf9, 0x18, 0x6f, 0xa5, 0xeb, 0xfa, 0x71,
+    0x8d, 0x76, 0x0f, 0xb8, 0xe1, 0xae, 0x82, 0xc3, 0x13, 0xf2, 0x0b, 0x86, 0xfb, 0xb5, 0x27, 0xfc,
+    0x23, 0x17, 0x10, 0x9d, 0x95, 0xdd, 0xee, 0x73, 0x59, 0xc9, 0x10, 0x60, 0x78, 0x38, 0xd8, 0x81,
+    0x96, 0x45, 0xf3, 0xe3, 0x3a, 0xcf, 0xf2, 0xd1, 0x0a, 0xfd, 0xd8, 0x85, 0x38, 0xb0, 0x21, 0x39,
+    0x47, 0xa5, 0xab, 0xa6, 0x2b, 0xc9, 0xfa, 0xf0, 0x19, 0x0a, 0x63, 0x5d, 0xbe, 0xdf, 0x3b, 0xe1,
+    0x59, 0x32, 0xcf, 0x84, 0x0b, 0x66, 0x38, 0x5d, 0x06, 0x62, 0xd0, 0x76, 0x0e, 0xa4, 0xb4, 0x4d,
+    0x7c, 0xe9, 0x40, 0x4f, 0x14, 0xee, 0xdc, 0x06, 0x19, 0x38, 0xf3, 0x7c, 0x8b, 0x12, 0x15, 0xa9,
+    0x32, 0x6c, 0x59, 0x1a, 0x79, 0x35, 0xed, 0x2c, 0x4b, 0xcd, 0x53, 0x9e, 0xdd, 0x22, 0x87, 0x46,
+    0x30, 0xde, 0x35, 0x0c, 0xee, 0x61, 0xb5, 0x0e, 0x44, 0x39, 0x90, 0xb7, 0x7f, 0x18, 0x38, 0x15,
+    0xa5, 0x3f, 0x31, 0xa8, 0x3c, 0x0b, 0xb3, 0xfb, 0x60, 0xa0, 0x0f, 0x40, 0x2b, 0x89, 0xa2, 0xc9,
+    0x07, 0x47, 0x1f, 0x1b, 0xaf, 0x75, 0xc8, 0x72, 0xc0, 0x33, 0xc5, 0x1a, 0xaf, 0xf7, 0xe4, 0x8e,
+    0x34, 0x6e, 0x0d, 0xad, 0x76, 0x1c, 0xea, 0x6c, 0x8e, 0xb9, 0x13, 0x1f, 0x01, 0xfb, 0xc1, 0x6b,
+    0x3e, 0xfa, 0x70, 0xcf, 0xfa, 0xe2, 0xf9, 0x0f, 0x97, 0xdf, 0x7e, 0xa3, 0xaf, 0x65, 0xe3, 0xc1,
+    0x45, 0xc1, 0xa9, 0xc6, 0x49, 0x1f, 0x6d, 0xd7, 0x66, 0xae, 0xc7, 0x78, 0x64, 0x3f, 0xcf, 0x70,
+    0xae, 0x41, 0x0e, 0xe4, 0x6a, 0xd2, 0x6e, 0x52, 0x34, 0x62, 0x48, 0x54, 0x4d, 0xa5, 0xa1, 0x85,
+    0xe8, 0x87, 0xd6, 0xae, 0x0d, 0xc2, 0xa8, 0x11, 0x50, 0xca, 0x20, 0x5a, 0x0d, 0x62, 0xdd, 0x2e,
+    0x59, 0x86, 0xa0, 0x14, 0xf4, 0xdf, 0x52, 0x22, 0xb9, 0xac, 0x51, 0x12, 0x1e, 0xf3, 0xc2, 0x73,
+    0x41, 0xb0, 0x50, 0x01, 0x22, 0xa7, 0xb7, 0xb8, 0x93, 0x31, 0xd7, 0x8b, 0x83, 0x27, 0x14, 0x64,
+    0x7d, 0xc3, 0x55, 0x9f, 0xac, 0xea, 0x97, 0x57, 0x5e, 0x22, 0x34, 0xf9, 0xe5, 0x57, 0x09, 0x34,
+    0x50, 0x2c, 0xdb, 0xbc, 0x16, 0xd1, 0xfa, 0x9c, 0xf1, 0x0e, 0xc0, 0xaa, 0xf7, 0x1b, 0x51, 0x6f,
+    0x1c, 0x55, 0xa6, 0x1f, 0x43, 0x63, 0x0a, 0xa9, 0x73, 0x3d, 0x27, 0xb7, 0x97, 0x21, 0x46, 0xc7,
+    0x9b, 0xad, 0x3d, 0x18, 0xa5, 0x5c, 0x50, 0x2f, 0xe0, 0x9c, 0xbc, 0xf3, 0x88, 0x0d, 0x1c, 0xe3,
+    0xa5, 0x8d, 0xeb, 0x4d, 0xba, 0xc4, 0x40, 0x1f, 0x24, 0xf0, 0x4d, 0xc7, 0x23, 0xd5, 0x8c, 0xa0,
+    0xe6, 0xfc, 0x31, 0xbd, 0xeb, 0x9b, 0x2a, 0x48, 0x47, 0xb1, 0x24, 0x7c, 0x97, 0x66, 0xbc, 0x96,
+    0x4c, 0xbf, 0x7a, 0x34, 0x57, 0x90, 0x75, 0xcb, 0x13, 0x54, 0x68, 0x88, 0xc1, 0x76, 0x0e, 0x0b,
+    0xcb, 0x29, 0x87, 0xc4, 0xd7, 0x98, 0xda, 0xe5, 0xea, 0xef, 0x23, 0xb4, 0xe1, 0xf5, 0xe3, 0x59,
+    0x27, 0x02, 0x78, 0x65, 0x41, 0x44, 0x97, 0x80, 0x4f, 0x1c, 0xa6, 0x5c, 0x4d, 0x2b, 0x5c, 0x8b,
+    0x05, 0x91, 0x8d, 0xcf, 0x3d, 0xff, 0xd2, 0xeb, 0xb1, 0x3f, 0x73, 0x6e, 0xfd, 0x59, 0x34, 0xf2,
+    0x6b, 0xe3, 0xe8, 0x0b, 0xcd, 0x7c, 0x05, 0xb1, 0x17, 0xb0, 0xe8, 0x8b, 0x50, 0xc0, 0xba, 0x7e,
+    0xaf, 0xc8, 0x64, 0x75, 0x8f, 0xd3, 0x5d, 0x82, 0x5c, 0x6a, 0xf5, 0x8c, 0x1a, 0x57, 0x0b, 0x18,
+    0x63, 0x09, 0xfc, 0xbe, 0xb6, 0xe5, 0xde, 0x4b, 0x32, 0xf9, 0x6d, 0x0e, 0xca, 0xd5, 0x68, 0xf2,
+    0x2d, 0x67, 0xe5, 0xbd, 0x66, 0xdc, 0x77, 0x7c, 0x00, 0x17, 0x1e, 0xa8, 0xb1, 0x90, 0x2b, 0x98,
+    0x56, 0x72, 0x07, 0xd2, 0xcd, 0x77, 0x9b, 0xa9, 0xbd, 0x3d, 0x39, 0x29, 0xd4, 0x1b, 0xe5, 0x80,
+    0x40, 0xe1, 0x95, 0x3e, 0x98, 0xf2, 0xf4, 0x0b, 0xec, 0x8e, 0x1a, 0x77, 0x02, 0x1d, 0x12, 0xfb,
+    0xd8, 0x73, 0xdf, 0xcf, 0xbc, 0x27, 0x5f, 0xef, 0xa3, 0x5c, 0xe6, 0x53, 0x5d, 0xdd, 0xf3, 0x8c,
+    0xae, 0xee, 0xf9, 0xd1, 0x74, 0x75, 0x8f, 0x1a, 0x5a, 0xe1, 0x17, 0xf5, 0xec, 0x7b, 0x70, 0xe8,
+    0x8b, 0xf7, 0x28, 0x32, 0x0f, 0xad, 0xac, 0xb9, 0xd2, 0x45, 0x26, 0x8d, 0x97, 0x1d, 0xca, 0x82,
+    0x8c, 0x5c, 0xdc, 0xd4, 0x74, 0xda, 0x5e, 0xb4, 0x38, 0xc8, 0x2d, 0xb9, 0x6b, 0xea, 0xef, 0x81,
+    0xc5, 0xcb, 0x3d, 0x15, 0x94, 0x20, 0x1d, 0x94, 0xce, 0x42, 0x3a, 0xf1, 0xfb, 0x37, 0xb0, 0x7e,
+    0xa4, 0xaa, 0x3a, 0x5d, 0x4a, 0x7a, 0x5c, 0xc1, 0xc6, 0x98, 0x56, 0xb2, 0xbc, 0x58, 0x47, 0xb0,
+    0x80, 0xb5, 0x2a, 0x47, 0x8a, 0x22, 0xcb, 0xc5, 0x30, 0x8f, 0x99, 0x5c, 0xcc, 0xb0, 0xb4, 0x6b,
+    0x75, 0x62, 0xf6, 0xe7, 0x78, 0xbf, 0xd8, 0xa6, 0x02, 0x18, 0xb1, 0x5e, 0xbf, 0x1f, 0x1c, 0xb3,
+    0x6b, 0xd2, 0xcf, 0xd7, 0xea, 0x2a, 0xb3, 0x58, 0xa0, 0x24, 0xa8, 0x58, 0x53, 0x37, 0x1f, 0xe6,
+    0xa1, 0x75, 0x10, 0xad, 0x5f, 0x80, 0xd5, 0x50, 0x3f, 0xd1, 0xbe, 0xf3, 0xdb, 0xcd, 0xe7, 0x1f,
+    0xea, 0x38, 0xc7, 0xcb, 0x7a, 0x57, 0x9f, 0xda, 0xb1, 0x71, 0x6d, 0xf3, 0x10, 0x47, 0x55, 0x6d,
+    0xae, 0xfe, 0x22, 0x9a, 0x28, 0x22, 0x57, 0x7e, 0xca, 0xf8, 0x6d, 0x2e, 0xec, 0xd4, 0x58, 0xed,
+    0x10, 0xef, 0xb4, 0xba, 0x6c, 0x4a, 0xe5, 0xbc, 0x72, 0xc0, 0x1c, 0x37, 0x0f, 0x95, 0x5e, 0xab,
+    0x87, 0xd3, 0x4e, 0xeb, 0x07, 0xae, 0xf6, 0x1c, 0xd5, 0xad, 0xc3, 0x0a, 0xad, 0x4e, 0x74, 0x4b,
+    0x20, 0xa3, 0x3c, 0xf8, 0x36, 0x68, 0x1c, 0xc9, 0xa6, 0x96, 0x8e, 0xe4, 0x43, 0xba, 0xca, 0x4d,
+    0x33, 0xfa, 0x41, 0x45, 0x33, 0x61, 0x6a, 0x1c, 0xe3, 0xb1, 0xc4, 0x55, 0xb7, 0xd3, 0x7d, 0x22,
+    0xea, 0x6a, 0x53, 0x7a, 0x38, 0x65, 0xda, 0x3d, 0x46, 0x9f, 0x80, 0x32, 0xe9, 0xfc, 0x56, 0x63,
+    0x13, 0xf2, 0xc3, 0xc2, 0x52, 0x5d, 0x7d, 0x89, 0x73, 0x34, 0xfa, 0xfa, 0xe3, 0xd7, 0x90, 0x86,
+    0x4b, 0xb2, 0x64, 0x07, 0x9d, 0xee, 0x39, 0xe8, 0x6c, 0xcf, 0xa0, 0x01, 0xb9, 0xd5, 0x8e, 0x9e,
+    0x32, 0x72, 0x66, 0xbe, 0x07, 0x1c, 0xa0, 0x64, 0x28, 0x71, 0xae, 0x01, 0x41, 0x91, 0x53, 0xd5,
+    0x8b, 0x34, 0x8d, 0x4d, 0x39, 0xa0, 0xf3, 0x08, 0x66, 0xee, 0x9b, 0x63, 0x54, 0x24, 0x3d, 0x65,
+    0x8a, 0xb5, 0xdd, 0xf5, 0x06, 0x6d, 0x0d, 0xd2, 0x9a, 0x47, 0xf7, 0x1e, 0x3b, 0xd7, 0xed, 0x8b,
+    0xe3, 0x23, 0x90, 0xa7, 0x1e, 0x82, 0x7c, 0x2c, 0x69, 0xad, 0x4a, 0xe5, 0xf1, 0x94, 0xb5, 0x04,
+    0x31, 0xe5, 0xe8, 0xa2, 0x44, 0x1e, 0x3d, 0xb0, 0x86, 0x59, 0xf2, 0x81, 0x65, 0x56, 0x9d, 0xaf,
+    0xee, 0x57, 0x79, 0xd5, 0x23, 0x27, 0x03, 0xe8, 0x52, 0x4d, 0x96, 0x0d, 0xca, 0x61, 0x8f, 0xb8,
+    0x88, 0x51, 0x8a, 0x1f, 0x18, 0xfa, 0xb6, 0xf4, 0xed, 0x1a, 0x84, 0xfc, 0xfb, 0xa4, 0xfc, 0xff,
+    0xf7, 0x93, 0xf2, 0xea, 0x2d, 0x56, 0x9f, 0x68, 0xa7, 0xf5, 0x4a, 0xdf, 0x87, 0xae, 0x2e, 0x23,
+    0x13, 0xdd, 0x5b, 0x14, 0x8f, 0xb6, 0x72, 0xbe, 0xa9, 0x65, 0xfa, 0xcd, 0x00, 0xfc, 0xed, 0x03,
+    0x75, 0x53, 0x51, 0xfc, 0x5a, 0xa7, 0xf4, 0x9b, 0x16, 0xd5, 0xa6, 0x9a, 0x76, 0xff, 0x96, 0xfc,
+    0x5b, 0x08, 0xd2, 0xd6, 0xd8, 0xf9, 0xb3, 0x2c, 0x64, 0xf7, 0xe9, 0x0e, 0xf8, 0x26, 0x3e, 0xdc,
+    0x05, 0x09, 0x9d, 0x5e, 0x22, 0x6a, 0x68, 0x57, 0x6c, 0x19, 0xde, 0x46, 0x8b, 0x10, 0xd3, 0x04,
+    0xa5, 0x74, 0x6a, 0x03, 0x7a, 0xcf, 0xf5, 0xeb, 0xae, 0x5b, 0x76, 0x04, 0xd9, 0x0d, 0xa0, 0xde,
+    0xb9, 0x72, 0x79, 0xac, 0x53, 0xee, 0xfc, 0xf1, 0x07, 0xdb, 0xe8, 0x64, 0x65, 0xc6, 0x7f, 0xec,
+    0xc5, 0xb4, 0x87, 0x67, 0xba, 0x7d, 0x50, 0xfd, 0x09, 0xa6, 0xd6, 0x9f, 0x5e, 0x62, 0x37, 0x81,
+    0xc6, 0xa2, 0xf2, 0x27, 0x4e, 0x7d, 0x7d, 0x3f, 0x96, 0x75, 0x5f, 0x8f, 0xa7, 0x5d, 0x10, 0x88,
+    0xbf, 0xe4, 0x1b, 0x13, 0x77, 0xdb, 0xae, 0x5b, 0xdf, 0x77, 0x9f, 0x5e, 0xe3, 0xfe, 0xb6, 0xe6,
+    0x6f, 0xc8, 0x11, 0xe7, 0xda, 0x6a, 0x55, 0xae, 0x2d, 0xa7, 0xe5, 0x3b, 0x45, 0x8c, 0x5b, 0x6b,
+    0xb5, 0xfd, 0xec, 0xc0, 0x05, 0x35, 0x22, 0x5f, 0xbd, 0x47, 0x09, 0xd5, 0xde, 0x8c, 0xf1, 0xe6,
+    0xbd, 0xb9, 0xe9, 0xea, 0xbd, 0xee, 0x4b, 0xf8, 0x1e, 0xc3, 0x64, 0x92, 0x8e, 0xbf, 0x87, 0xf9,
+    0x1f, 0xe7, 0x70, 0xc5, 0x2b, 0xd0, 0x05, 0x59, 0xf1, 0x07, 0x59, 0x45, 0xf5, 0x1e, 0x7b, 0x49,
+    0xe1, 0x87, 0xb3, 0xaa, 0x71, 0x5f, 0x24, 0x53, 0xae, 0xcd, 0xe3, 0x7a, 0x63, 0x15, 0x86, 0x4b,
+    0x94, 0x9f, 0xf6, 0x6b, 0x0c, 0x9b, 0x0b, 0xca, 0xd4, 0xf0, 0xd5, 0xfe, 0xad, 0x4a, 0x99, 0x79,
+    0x4d, 0x88, 0xde, 0xbe, 0xd1, 0xa8, 0x3c, 0xae, 0xfa, 0x35, 0xff, 0xc5, 0xde, 0x33, 0x3c, 0x2e,
+    0xd6, 0xa2, 0x58, 0xab, 0xd9, 0x1f, 0x48, 0xca, 0x5c, 0xb9, 0xf5, 0xd0, 0xd4, 0x3a, 0x17, 0xdb,
+    0x03, 0x9a, 0x97, 0x57, 0xf0, 0x41, 0x3d, 0x18, 0xdc, 0x95, 0xa6, 0x30, 0x19, 0xb6, 0x25, 0xe5,
+    0x7c, 0xfd, 0x21, 0x01, 0x13, 0x47, 0x0e, 0x60, 0x88, 0x3e, 0x68, 0xd9, 0x84, 0x5d, 0x8a, 0x83,
+    0x9d, 0xed, 0x0d, 0x49, 0x23, 0x6c, 0xb1, 0x3e, 0xb2, 0x6b, 0xa0, 0x6e, 0x98, 0x72, 0x2a, 0x55,
+    0xd3, 0x46, 0xdd, 0xa2, 0xf8, 0xb7, 0x2f, 0x09, 0xc9, 0x54, 0x37, 0xce, 0xd5, 0x0b, 0x12, 0xa8,
+    0xf9, 0x4f, 0x7f, 0xb4, 0xfe, 0x0f, 0x9f, 0x98, 0xd7, 0x77, 0x2d, 0x3b, 0xce, 0xe6, 0xe9, 0x46,
+    0xd4, 0xee, 0x0d, 0x3a, 0xcf, 0x11, 0x36, 0x67, 0xb1, 0x1b, 0x43, 0xec, 0x3f, 0x9a, 0xf5, 0x89,
+    0xce, 0x68, 0x99, 0x15, 0xe3, 0xc7, 0x38, 0xb8, 0xa5, 0x5f, 0x73, 0x2f, 0x69, 0xbb, 0x8f, 0x76,
+    0x9c, 0xab, 0xa5, 0x8f, 0xb6, 0x5f, 0x40, 0x69, 0xd5, 0xbf, 0x1f, 0x78, 0xee, 0x8b, 0xfd, 0x81,
+    0x13, 0x60, 0xdc, 0xf4, 0x98, 0xcf, 0x81, 0xed, 0x43, 0x60, 0x7f, 0xf4, 0x3c, 0x58, 0x09, 0x29,
+    0xb9, 0x54, 0xe3, 0x31, 0x84, 0xfa, 0xe4, 0x95, 0x6d, 0x06, 0x6c, 0x1d, 0xc7, 0xaf, 0x7e, 0x0c,
+    0x97, 0x51, 0xc6, 0x55, 0x04, 0x2e, 0x15, 0x5c, 0x24, 0xeb, 0x74, 0x13, 0x6e, 0xf1, 0x31, 0xb2,
+    0x28, 0x61, 0x01, 0xa8, 0x87, 0x3b, 0x40, 0x9a, 0xf8, 0xec, 0x58, 0x6e, 0xdb, 0x2d, 0xed, 0x9b,
+    0xa7, 0x46, 0x7b, 0x5e, 0x51, 0x3a, 0x56, 0x60, 0x7e, 0xaa, 0x53, 0xec, 0x89, 0xc7, 0x29, 0xd7,
+    0x19, 0x36, 0xde, 0x73, 0x8b, 0x4e, 0xe7, 0x49, 0x4f, 0x5b, 0xad, 0xc7, 0x6c, 0xa2, 0x9f, 0x46,
+    0x30, 0x9e, 0x3f, 0x68, 0x3b, 0xbc, 0x6a, 0xb2, 0x08, 0x8f, 0xdb, 0xda, 0x37, 0x41, 0xbd, 0x0f,
+    0x32, 0x39, 0xe5, 0xaf, 0xc6, 0x77, 0x39, 0xb0, 0x2a, 0x00, 0x94, 0xdb, 0x10, 0x69, 0xcd, 0x1b,
+    0x23, 0xe4, 0x5f, 0xbc, 0x95, 0x9d, 0x40, 0x51, 0x5e, 0xd1, 0x66, 0x87, 0x03, 0x28, 0xe5, 0x77,
+    0x74, 0x8d, 0xb6, 0x64, 0xff, 0x14, 0x3e, 0x68, 0xf7, 0x18, 0x55, 0x37, 0xb5, 0x20, 0x29, 0xff,
+    0x0b, 0x00, 0x00, 0xff, 0xff,
+};
+
+static constexpr const uint8_t index_html4_gz[] PROGMEM = {
+    0x4a, 0xb0, 0xe6, 0x52, 0x00, 0x83, 0xe4, 0xfc, 0xbc, 0xe2, 0x12, 0x85, 0x92, 0xcc, 0x92, 0x9c,
+    0xd4, 0xf8, 0x92, 0xd4, 0x8a, 0x12, 0x05, 0x5b, 0x85, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+};
+
+static constexpr const uint8_t index_html5_gz[] PROGMEM = {
+    0x4a, 0xb0, 0xe6, 0x52, 0x00, 0x83, 0xe4, 0xfc, 0xbc, 0xe2, 0x12, 0x85, 0x92, 0xcc, 0x92, 0x9c,
+    0xd4, 0xf8, 0xe2, 0xd2, 0x24, 0x05, 0x5b, 0x85, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+};
+
+static constexpr const uint8_t index_html6_gz[] PROGMEM = {
+    0x4a, 0xb0, 0xe6, 0x52, 0x00, 0x83, 0xe4, 0xfc, 0xbc, 0xe2, 0x12, 0x85, 0x92, 0xcc, 0x92, 0x9c,
+    0xd4, 0xf8, 0xcc, 0xbc, 0xb4, 0x7c, 0x05, 0x5b, 0x85, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+};
+
+static constexpr const uint8_t index_html7_gz[] PROGMEM = {
+    0x4a, 0xb0, 0xe6, 0x52, 0x00, 0x83, 0xe4, 0xfc, 0xbc, 0xe2, 0x12, 0x85, 0xcc, 0xbc, 0x82, 0xd2,
+    0x92, 0xf8, 0xbc, 0xc4, 0xdc, 0xd4, 0xf8, 0x92, 0xd4, 0x8a, 0x12, 0x05, 0x5b, 0x85, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff,
+};
+
+static constexpr const uint8_t index_html8_gz[] PROGMEM = {
+    0x4a, 0xb0, 0xe6, 0x52, 0x00, 0x83, 0xe4, 0xfc, 0xbc, 0xe2, 0x12, 0x85, 0xcc, 0xbc, 0x82, 0xd2,
+    0x92, 0xf8, 0x9c, 0xd4, 0xbc, 0xf4, 0x8c, 0x12, 0x05, 0x5b, 0x05, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xff,
+};
+
+static constexpr const uint8_t index_html9_gz[] PROGMEM = {
+    0xb2, 0xe6, 0x52, 0x00, 0x83, 0xe4, 0xfc, 0xbc, 0xe2, 0x12, 0x10, 0x99, 0x97, 0x9a, 0x5c, 0x92,
+    0x99, 0x9f, 0x17, 0x5f, 0x5c, 0x9a, 0x9c, 0x9c, 0x5a, 0x5c, 0x9c, 0x56, 0x9a, 0x13, 0x5f, 0x92,
+    0x5a, 0x51, 0xa2, 0x60, 0xab, 0x90, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+};
+
+static constexpr const uint8_t index_html10_gz[] PROGMEM = {
+    0x4a, 0xb0, 0xe6, 0x52, 0x00, 0x83, 0xe4, 0xfc, 0xbc, 0xe2, 0x12, 0x85, 0xb4, 0xfc, 0xfc, 0x92,
+    0xd4, 0xa2, 0xf8, 0x92, 0xd4, 0x8a, 0x12, 0x05, 0x5b, 0x85, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xff,
+};
+
+static constexpr const uint8_t index_html11_gz[] PROGMEM = {
+    0x4a, 0xb0, 0xe6, 0x52, 0x00, 0x83, 0xe4, 0xfc, 0xbc, 0xe2, 0x12, 0x85, 0xa2, 0xd4, 0xe2, 0xd4,
+    0x92, 0x78, 0x20, 0x3b, 0x2d, 0xb3, 0x28, 0x37, 0xb1, 0x24, 0x33, 0x3f, 0x2f, 0xbe, 0x24, 0xb5,
+    0xa2, 0x44, 0xc1, 0x56, 0x21, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff,
+};
+
+static constexpr const uint8_t index_html12_gz[] PROGMEM = {
+    0x4a, 0xb0, 0xe6, 0x52, 0x00, 0x83, 0xe4, 0xfc, 0xbc, 0xe2, 0x12, 0x85, 0xa2, 0xd4, 0xe2, 0xd4,
+    0x92, 0xf8, 0xe2, 0x8c, 0xfc, 0x72, 0x05, 0x5b, 0x05, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+};
+
+static constexpr const uint8_t index_html13_gz[] PROGMEM = {
+    0xb2, 0xe6, 0xe2, 0x52, 0x00, 0x02, 0x1b, 0xfd, 0xe2, 0xe4, 0xa2, 0xcc, 0x82, 0x12, 0x3b, 0x2e,
+    0x10, 0x3b, 0x29, 0x3f, 0xa5, 0xd2, 0x8e, 0xcb, 0x46, 0x3f, 0xa3, 0x24, 0x37, 0xc7, 0x8e, 0x0b,
+    0x00, 0x00, 0x00, 0xff, 0xff,
+};
+
+// FNV-1a hash of all static fragments, used in the page ETag and
+// checked against provision_html.h when page_cache.cpp is compiled
+static constexpr uint32_t index_html_hash = 0xe91cacb3;
+
+#endif // PROVISION_HTML_GZ_H
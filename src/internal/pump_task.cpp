@@ -0,0 +1,109 @@
+#include "pump_task.h"
+#include <Arduino.h>
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+PumpTask::PumpTask() : _running(false), _handle(nullptr) {}
+
+PumpTask::~PumpTask() { join(); }
+
+/**
+ * @brief Starts `function` in a new FreeRTOS task.
+ *
+ * @param function The function to run.
+ * @param stackSize The stack size of the task in bytes.
+ * @param priority The priority of the task.
+ * @param core The core to pin the task to, or a negative value for no
+ * affinity.
+ *
+ * @return `true` if the task was created, `false` if a task is still running
+ * or the task could not be created.
+ */
+bool PumpTask::start(Function function, uint32_t stackSize, unsigned priority,
+                     int core) {
+  if (_running) {
+    return false;
+  }
+
+  _function = std::move(function);
+  _running = true;
+  BaseType_t result = xTaskCreatePinnedToCore(
+      trampoline, "WiFiProvisioner", stackSize, this, priority, &_handle,
+      core < 0 ? tskNO_AFFINITY : core);
+  if (result != pdPASS) {
+    _running = false;
+    _handle = nullptr;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Waits until the task has finished. Returns at once when called from
+ * the task itself.
+ */
+void PumpTask::join() {
+  if (isCurrent()) {
+    return;
+  }
+  while (_running) {
+    delay(10);
+  }
+}
+
+bool PumpTask::isCurrent() const {
+  return _running && xTaskGetCurrentTaskHandle() == _handle;
+}
+
+void PumpTask::trampoline(void *arg) {
+  static_cast<PumpTask *>(arg)->run();
+  vTaskDelete(nullptr);
+}
+
+#else
+
+PumpTask::PumpTask() : _running(false) {}
+
+PumpTask::~PumpTask() { join(); }
+
+bool PumpTask::start(Function function, uint32_t, unsigned, int) {
+  if (_running) {
+    return false;
+  }
+  if (_thread.joinable()) {
+    _thread.join();
+  }
+
+  _function = std::move(function);
+  _running = true;
+  _thread = std::thread([this]() { run(); });
+  return true;
+}
+
+void PumpTask::join() {
+  if (isCurrent() || !_thread.joinable()) {
+    return;
+  }
+  _thread.join();
+}
+
+bool PumpTask::isCurrent() const {
+  return std::this_thread::get_id() == _thread.get_id();
+}
+
+#endif
+
+bool PumpTask::isRunning() const { return _running; }
+
+/**
+ * @brief Acquires the statistics lock. Must not be held while calling back
+ * into the application.
+ */
+void PumpTask::lock() { _mutex.lock(); }
+
+void PumpTask::unlock() { _mutex.unlock(); }
+
+void PumpTask::run() {
+  _function();
+  _running = false;
+}
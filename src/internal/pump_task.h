@@ -0,0 +1,62 @@
+#ifndef PUMP_TASK_H
+#define PUMP_TASK_H
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <stdint.h>
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#else
+#include <thread>
+#endif
+
+/**
+ * @brief Runs the provisioning pump on a dedicated task.
+ *
+ * On ESP32 the function runs in a FreeRTOS task with the requested stack size,
+ * priority and core. Elsewhere a POSIX thread stands in for the task, where
+ * the stack size, priority and core are ignored.
+ *
+ * The task also provides the lock under which it updates the statistics that
+ * other tasks read, so that `std::lock_guard<PumpTask>` gives a consistent
+ * snapshot of them.
+ */
+class PumpTask {
+public:
+  using Function = std::function<void()>;
+
+  PumpTask();
+  ~PumpTask();
+
+  bool start(Function function, uint32_t stackSize, unsigned priority,
+             int core);
+  void join();
+
+  bool isRunning() const;
+  bool isCurrent() const;
+
+  void lock();
+  void unlock();
+
+private:
+  PumpTask(const PumpTask &) = delete;
+  PumpTask &operator=(const PumpTask &) = delete;
+
+  void run();
+
+  Function _function;
+  std::atomic<bool> _running;
+  std::mutex _mutex; // Guards the statistics shared with other tasks
+#if defined(ARDUINO_ARCH_ESP32)
+  static void trampoline(void *arg);
+
+  TaskHandle_t _handle;
+#else
+  std::thread _thread;
+#endif
+};
+
+#endif // PUMP_TASK_H
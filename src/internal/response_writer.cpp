@@ -0,0 +1,190 @@
+#include "response_writer.h"
+#include <stdio.h>
+#include <string.h>
+
+ResponseWriter::ResponseWriter(WiFiProvisionerPlatform::HttpServer &server,
+                               WiFiProvisioner::ResponseStats &stats)
+    : _server(server), _stats(stats), _length(0), _chunkStart(NO_CHUNK),
+      _statusCode(0), _chunked(false), _ended(false) {}
+
+WiFiProvisionerPlatform::HttpServer &ResponseWriter::server() {
+  return _server;
+}
+
+/**
+ * @brief Records the status code of the response, which `end()` counts as an
+ * error if it is 400 or above.
+ */
+void ResponseWriter::setStatus(int statusCode) { _statusCode = statusCode; }
+
+/**
+ * @brief Appends header bytes. Must be called before the first body byte.
+ */
+void ResponseWriter::writeHeader(const char *header, size_t length) {
+  append(reinterpret_cast<const uint8_t *>(header), length);
+}
+
+/**
+ * @brief Asks the server whether the body may be sent chunked and, if so,
+ * frames all following body bytes as chunks.
+ *
+ * @return `true` if the body is chunked. Otherwise it ends when the server
+ * closes the connection after the response.
+ */
+bool ResponseWriter::beginChunked() {
+  _chunked = _server.beginChunked();
+  return _chunked;
+}
+
+size_t ResponseWriter::write(uint8_t c) { return write(&c, 1); }
+
+/**
+ * @brief Appends body bytes.
+ *
+ * @return The number of bytes accepted, `0` once `end()` has been called.
+ */
+size_t ResponseWriter::write(const uint8_t *data, size_t length) {
+  if (_ended) {
+    return 0;
+  }
+  if (!_chunked) {
+    append(data, length);
+    return length;
+  }
+
+  size_t remaining = length;
+  while (remaining > 0) {
+    if (_chunkStart == NO_CHUNK) {
+      if (_length + PREFIX_SIZE >= CAPACITY) {
+        flush();
+      }
+      _chunkStart = _length;
+      _length += PREFIX_SIZE;
+    }
+    size_t count = CAPACITY - _length;
+    if (count > remaining) {
+      count = remaining;
+    }
+    memcpy(_buffer + _length, data, count);
+    _length += count;
+    data += count;
+    remaining -= count;
+    if (_length == CAPACITY) {
+      flush();
+    }
+  }
+  return length;
+}
+
+/**
+ * @brief Appends body bytes that stay valid and unchanged until the response
+ * has been sent, such as the cached page.
+ *
+ * Whatever does not fit the buffer is passed to the server's
+ * `writeBorrowed()`, so a client that reads slowly does not make the server
+ * copy it. A chunked body is framed and copied as with `write()`.
+ *
+ * @return The number of bytes accepted, `0` once `end()` has been called.
+ */
+size_t ResponseWriter::writeBorrowed(const uint8_t *data, size_t length) {
+  if (_ended || _chunked) {
+    return write(data, length);
+  }
+  append(data, length, true);
+  return length;
+}
+
+/**
+ * @brief Sends the buffered bytes and, for a chunked body, the last chunk,
+ * then ends the response on the server. Later writes are ignored.
+ */
+void ResponseWriter::end() {
+  if (_ended) {
+    return;
+  }
+  closeChunk();
+  if (_chunked) {
+    memcpy(_buffer + _length, "0\r\n\r\n", 5);
+    _length += 5;
+  }
+  if (_length > 0) {
+    send(_buffer, _length);
+    _length = 0;
+  }
+  _ended = true;
+  _stats.responses++;
+  if (_statusCode >= 400) {
+    _stats.errors++;
+  }
+  _server.endResponse();
+}
+
+/**
+ * @brief Appends bytes unframed, sending the buffer whenever it is full.
+ * Whatever remains of a large write once the buffer has been sent goes to
+ * the server directly, as borrowed bytes if `borrowed` is set.
+ */
+void ResponseWriter::append(const uint8_t *data, size_t length,
+                            bool borrowed) {
+  while (length > 0) {
+    if (_length == 0 && length >= CAPACITY) {
+      send(data, length, borrowed);
+      return;
+    }
+    size_t count = CAPACITY - _length;
+    if (count > length) {
+      count = length;
+    }
+    memcpy(_buffer + _length, data, count);
+    _length += count;
+    data += count;
+    length -= count;
+    if (_length == CAPACITY) {
+      flush();
+    }
+  }
+}
+
+/**
+ * @brief Fills in the size line of the open chunk and terminates its data,
+ * or drops the chunk if it is empty.
+ */
+void ResponseWriter::closeChunk() {
+  if (_chunkStart == NO_CHUNK) {
+    return;
+  }
+  size_t size = _length - _chunkStart - PREFIX_SIZE;
+  if (size == 0) {
+    _length = _chunkStart;
+  } else {
+    char sizeLine[PREFIX_SIZE + 1];
+    snprintf(sizeLine, sizeof(sizeLine), "%04x\r\n",
+             static_cast<unsigned>(size));
+    memcpy(_buffer + _chunkStart, sizeLine, PREFIX_SIZE);
+    _buffer[_length++] = '\r';
+    _buffer[_length++] = '\n';
+  }
+  _chunkStart = NO_CHUNK;
+}
+
+void ResponseWriter::flush() {
+  closeChunk();
+  if (_length > 0) {
+    send(_buffer, _length);
+    _length = 0;
+  }
+}
+
+/**
+ * @brief Writes bytes to the server and counts the buffer-sized segments
+ * they take.
+ */
+void ResponseWriter::send(const uint8_t *data, size_t length, bool borrowed) {
+  if (borrowed) {
+    _server.writeBorrowed(data, length);
+  } else {
+    _server.write(data, length);
+  }
+  _stats.segments += (length + BUFFER_SIZE - 1) / BUFFER_SIZE;
+  _stats.bytes += length;
+}
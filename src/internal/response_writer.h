@@ -0,0 +1,78 @@
+#ifndef RESPONSE_WRITER_H
+#define RESPONSE_WRITER_H
+
+#include "../WiFiProvisioner.h"
+#include "../WiFiProvisionerPlatform.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef WIFI_PROVISIONER_RESPONSE_BUFFER_SIZE
+#define WIFI_PROVISIONER_RESPONSE_BUFFER_SIZE 1436 // The lwIP TCP MSS
+#endif
+
+/**
+ * @brief Collects an HTTP response in a fixed buffer and hands it to the
+ * server in as few writes as possible.
+ *
+ * The header and the body are appended to a buffer of
+ * `WIFI_PROVISIONER_RESPONSE_BUFFER_SIZE` bytes inside the writer, which is
+ * sent whenever it fills up and by `end()`. With the buffer sized to the TCP
+ * MSS, each write fills one segment however small the individual header lines
+ * and body fragments are. A body larger than the buffer is sent directly once
+ * the buffer has been filled.
+ *
+ * After `beginChunked()` has returned `true`, the body is framed with HTTP/1.1
+ * chunked transfer encoding, one chunk per buffer. Otherwise it is sent as is
+ * and must either match the `Content-Length` or end with the connection.
+ * Such a body may be written with `writeBorrowed()`, which lets the server
+ * queue a pointer to a large body instead of a copy.
+ *
+ * `JsonStream` writes JSON bodies through it.
+ */
+class ResponseWriter {
+public:
+  ResponseWriter(WiFiProvisionerPlatform::HttpServer &server,
+                 WiFiProvisioner::ResponseStats &stats);
+
+  WiFiProvisionerPlatform::HttpServer &server();
+
+  void setStatus(int statusCode);
+  void writeHeader(const char *header, size_t length);
+  bool beginChunked();
+  size_t write(uint8_t c);
+  size_t write(const uint8_t *data, size_t length);
+  size_t writeBorrowed(const uint8_t *data, size_t length);
+  void end();
+
+private:
+  static constexpr size_t BUFFER_SIZE = WIFI_PROVISIONER_RESPONSE_BUFFER_SIZE;
+  // Chunk size line as 4 hex digits and CRLF
+  static constexpr size_t PREFIX_SIZE = 6;
+  // CRLF after the chunk data followed by the last chunk
+  static constexpr size_t SUFFIX_SIZE = 7;
+  static constexpr size_t CAPACITY = BUFFER_SIZE - SUFFIX_SIZE;
+  static constexpr size_t NO_CHUNK = static_cast<size_t>(-1);
+
+  static_assert(BUFFER_SIZE >= 64 && BUFFER_SIZE <= 0xffff,
+                "WIFI_PROVISIONER_RESPONSE_BUFFER_SIZE must be between 64 and "
+                "65535");
+
+  ResponseWriter(const ResponseWriter &) = delete;
+  ResponseWriter &operator=(const ResponseWriter &) = delete;
+
+  void append(const uint8_t *data, size_t length, bool borrowed = false);
+  void closeChunk();
+  void flush();
+  void send(const uint8_t *data, size_t length, bool borrowed = false);
+
+  WiFiProvisionerPlatform::HttpServer &_server;
+  WiFiProvisioner::ResponseStats &_stats;
+  uint8_t _buffer[BUFFER_SIZE];
+  size_t _length;     // Bytes buffered
+  size_t _chunkStart; // Offset of the open chunk's size line, or `NO_CHUNK`
+  int _statusCode;
+  bool _chunked;
+  bool _ended;
+};
+
+#endif // RESPONSE_WRITER_H
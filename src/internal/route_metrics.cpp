@@ -0,0 +1,102 @@
+#include "route_metrics.h"
+
+const uint32_t WiFiProvisioner::RouteStats::LATENCY_BOUNDS[] = {
+    1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000};
+
+RouteMetrics::RouteMetrics() : _routes(), _count(0) {}
+
+/**
+ * @brief Forgets all routes and their counters.
+ */
+void RouteMetrics::clear() { _count.store(0, std::memory_order_release); }
+
+/**
+ * @brief Adds a route with cleared counters.
+ *
+ * @param route The path of the route. It must outlive the metrics.
+ *
+ * @return The index to record the route's requests with, or `NO_ROUTE` if
+ * `MAX_ROUTES` routes have been added already.
+ */
+size_t RouteMetrics::add(const char *route) {
+  size_t index = _count.load(std::memory_order_relaxed);
+  if (index >= MAX_ROUTES) {
+    return NO_ROUTE;
+  }
+
+  Route &entry = _routes[index];
+  entry.path = route;
+  entry.requests.store(0, std::memory_order_relaxed);
+  entry.errors.store(0, std::memory_order_relaxed);
+  entry.bytes.store(0, std::memory_order_relaxed);
+  for (size_t i = 0; i < LATENCY_BUCKETS; ++i) {
+    entry.latency[i].store(0, std::memory_order_relaxed);
+  }
+  // Publish the route only once it is initialised
+  _count.store(index + 1, std::memory_order_release);
+  return index;
+}
+
+/**
+ * @brief Records a handled request.
+ *
+ * @param index The index `add()` returned for the route.
+ * @param latencyMicros The time the handler took in microseconds.
+ * @param error Whether the response had a 4xx or 5xx status.
+ * @param bytes The response bytes including headers.
+ */
+void RouteMetrics::record(size_t index, unsigned long latencyMicros,
+                          bool error, uint32_t bytes) {
+  if (index >= _count.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  size_t bucket = 0;
+  while (bucket < LATENCY_BUCKETS - 1 &&
+         latencyMicros > WiFiProvisioner::RouteStats::LATENCY_BOUNDS[bucket]) {
+    ++bucket;
+  }
+
+  Route &entry = _routes[index];
+  entry.requests.fetch_add(1, std::memory_order_relaxed);
+  if (error) {
+    entry.errors.fetch_add(1, std::memory_order_relaxed);
+  }
+  entry.bytes.fetch_add(bytes, std::memory_order_relaxed);
+  entry.latency[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+size_t RouteMetrics::count() const {
+  return _count.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Copies the counters of a route.
+ *
+ * @param index The index of the route, less than `count()`.
+ */
+void RouteMetrics::get(size_t index,
+                       WiFiProvisioner::RouteStats &stats) const {
+  const Route &entry = _routes[index];
+  stats.route = entry.path;
+  stats.requests = entry.requests.load(std::memory_order_relaxed);
+  stats.errors = entry.errors.load(std::memory_order_relaxed);
+  stats.bytes = entry.bytes.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < LATENCY_BUCKETS; ++i) {
+    stats.latency[i] = entry.latency[i].load(std::memory_order_relaxed);
+  }
+}
+
+/**
+ * @brief Copies the counters of the first `capacity` routes.
+ *
+ * @return The number of routes, which may exceed `capacity`.
+ */
+size_t RouteMetrics::snapshot(WiFiProvisioner::RouteStats *stats,
+                              size_t capacity) const {
+  size_t count = this->count();
+  for (size_t i = 0; i < count && i < capacity; ++i) {
+    get(i, stats[i]);
+  }
+  return count;
+}
@@ -0,0 +1,52 @@
+#ifndef ROUTE_METRICS_H
+#define ROUTE_METRICS_H
+
+#include "../WiFiProvisioner.h"
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Counts the requests, errors, response bytes and handler latencies of
+ * each route.
+ *
+ * The counters are only written by the task serving the portal and are
+ * 32-bit atomics, which the ESP32 updates without locks, so `snapshot()` can
+ * be called from any task or interrupt while requests are being served. A
+ * snapshot is consistent per counter, not across counters.
+ */
+class RouteMetrics {
+public:
+  static constexpr size_t MAX_ROUTES = 12;
+  static constexpr size_t LATENCY_BUCKETS =
+      WiFiProvisioner::RouteStats::LATENCY_BUCKETS;
+  static constexpr size_t NO_ROUTE = MAX_ROUTES;
+
+  RouteMetrics();
+
+  void clear();
+  size_t add(const char *route);
+  void record(size_t index, unsigned long latencyMicros, bool error,
+              uint32_t bytes);
+
+  size_t count() const;
+  void get(size_t index, WiFiProvisioner::RouteStats &stats) const;
+  size_t snapshot(WiFiProvisioner::RouteStats *stats, size_t capacity) const;
+
+private:
+  struct Route {
+    const char *path;
+    std::atomic<uint32_t> requests;
+    std::atomic<uint32_t> errors;
+    std::atomic<uint32_t> bytes;
+    std::atomic<uint32_t> latency[LATENCY_BUCKETS];
+  };
+
+  RouteMetrics(const RouteMetrics &) = delete;
+  RouteMetrics &operator=(const RouteMetrics &) = delete;
+
+  Route _routes[MAX_ROUTES];
+  std::atomic<size_t> _count;
+};
+
+#endif // ROUTE_METRICS_H
@@ -0,0 +1,401 @@
+#include "scan_engine.h"
+#include <Arduino.h>
+#include <cmath>
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+
+// A scan that has not completed by then is treated as failed
+const unsigned long SCAN_TIMEOUT = 15000;
+// How long no scan is started after one failed
+const unsigned long SCAN_RETRY_INTERVAL = 5000;
+
+} // namespace
+
+ScanEngine::ScanEngine(WiFiProvisionerPlatform::Radio &radio)
+    : _radio(radio), _tables(nullptr), _count(0), _scratchCount(0),
+      _removedCount(0), _version(0), _horizon(1), _limit(WIFI_PROVISIONER_MAX_NETWORKS),
+      _ttl(10000), _scanStartedAt(0), _resultsAt(0), _failedAt(0),
+      _scanning(false), _hasResults(false), _failed(false) {}
+
+ScanEngine::~ScanEngine() { free(_tables); }
+
+/**
+ * @brief Allocates the result tables, unless they are allocated already.
+ *
+ * @return `true` if the tables are allocated, `false` if there is not enough
+ * memory. Scans cannot be started without them.
+ */
+bool ScanEngine::allocate() {
+  if (_tables == nullptr) {
+    _tables = static_cast<Tables *>(malloc(sizeof(Tables)));
+  }
+  return _tables != nullptr;
+}
+
+/**
+ * @brief Drops the cached results as `reset()` does and frees the tables.
+ */
+void ScanEngine::release() {
+  reset();
+  free(_tables);
+  _tables = nullptr;
+}
+
+/**
+ * @brief Sets how long scan results are served before a rescan is started.
+ *
+ * @param ttl The time to live of the scan results in milliseconds.
+ */
+void ScanEngine::setTtl(unsigned long ttl) { _ttl = ttl; }
+
+/**
+ * @brief Sets how many networks are kept from a scan, capped at
+ * `WIFI_PROVISIONER_MAX_NETWORKS`. Takes effect with the next scan.
+ */
+void ScanEngine::setLimit(size_t limit) {
+  _limit = limit < WIFI_PROVISIONER_MAX_NETWORKS
+               ? limit
+               : WIFI_PROVISIONER_MAX_NETWORKS;
+}
+
+/**
+ * @brief Starts an asynchronous scan unless one is already running.
+ *
+ * After a scan failed to start, failed or timed out, no scan is started for
+ * `SCAN_RETRY_INTERVAL`, so a radio that keeps failing is not restarted at
+ * the rate of `/update` requests.
+ *
+ * @return `true` if a scan is running after the call, `false` if the scan
+ * could not be started, the tables are not allocated or the engine is
+ * waiting to retry.
+ */
+bool ScanEngine::start() {
+  if (_scanning) {
+    return true;
+  }
+  if (_tables == nullptr) {
+    return false;
+  }
+  if (_failed && millis() - _failedAt < SCAN_RETRY_INTERVAL) {
+    return false;
+  }
+
+  _radio.scanDelete();
+  if (!_radio.startScan()) {
+    fail();
+    return false;
+  }
+
+  _scanning = true;
+  _scanStartedAt = millis();
+  return true;
+}
+
+/**
+ * @brief Starts a background scan if the cached results are stale.
+ *
+ * @return `true` if a scan is running after the call.
+ */
+bool ScanEngine::refresh() {
+  if (!_scanning && isStale()) {
+    start();
+  }
+  return _scanning;
+}
+
+/**
+ * @brief Collects the results of a running scan once it has completed.
+ *
+ * Must be called regularly, typically from the provisioning loop. On failure
+ * the previous results are kept and the next scan waits for the retry
+ * interval.
+ */
+void ScanEngine::poll() {
+  if (!_scanning) {
+    return;
+  }
+
+  int16_t n = _radio.scanComplete();
+  if (n == WiFiProvisionerPlatform::Radio::SCAN_RUNNING) {
+    if (millis() - _scanStartedAt >= SCAN_TIMEOUT) {
+      _scanning = false;
+      _radio.scanDelete();
+      fail();
+    }
+    return;
+  }
+
+  _scanning = false;
+  if (n < 0) {
+    fail();
+    return;
+  }
+
+  collect(static_cast<size_t>(n));
+  _resultsAt = millis();
+  _hasResults = true;
+  _failed = false;
+
+  _radio.scanDelete();
+}
+
+/**
+ * @brief Drops the cached results and forgets any running scan.
+ *
+ * The empty table gets the next version, and since the removed networks are
+ * forgotten too, no changes are known from before it. A pending retry
+ * interval is cleared.
+ */
+void ScanEngine::reset() {
+  if (_scanning) {
+    _radio.scanDelete();
+  }
+  _scanning = false;
+  _hasResults = false;
+  _failed = false;
+  _count = 0;
+  _removedCount = 0;
+  _version++;
+  _horizon = _version;
+}
+
+/**
+ * @brief Records a failed scan, which holds off the next one for the retry
+ * interval.
+ */
+void ScanEngine::fail() {
+  _failed = true;
+  _failedAt = millis();
+}
+
+/**
+ * @brief Reduces the results of a completed scan into the scratch table and
+ * updates the table from it.
+ *
+ * Every result is read once. A result replaces the entry of its SSID if it
+ * is stronger, or takes a free slot, or, once `limit` entries are taken,
+ * evicts the weakest entry if it is stronger than that. An SSID evicted this
+ * way cannot come back with a weaker access point, since the weakest entry
+ * only gets stronger. The table is then sorted by signal strength, which
+ * takes an insertion sort over at most `WIFI_PROVISIONER_MAX_NETWORKS`
+ * entries.
+ *
+ * @param results The number of results the radio reported.
+ */
+void ScanEngine::collect(size_t results) {
+  Network *scratch = _tables->scratch;
+  _scratchCount = 0;
+  for (size_t i = 0; i < results; ++i) {
+    Network network;
+    if (!_radio.scanResult(i, network) || network.ssid[0] == '\0') {
+      continue;
+    }
+
+    size_t slot = _scratchCount;
+    size_t weakest = 0;
+    for (size_t j = 0; j < _scratchCount; ++j) {
+      if (strcmp(scratch[j].ssid, network.ssid) == 0) {
+        slot = j;
+        break;
+      }
+      if (scratch[j].rssi < scratch[weakest].rssi) {
+        weakest = j;
+      }
+    }
+
+    if (slot < _scratchCount) {
+      if (network.rssi > scratch[slot].rssi) {
+        scratch[slot] = network;
+      }
+    } else if (_scratchCount < _limit) {
+      scratch[_scratchCount++] = network;
+    } else if (_scratchCount > 0 && network.rssi > scratch[weakest].rssi) {
+      scratch[weakest] = network;
+    }
+  }
+
+  for (size_t i = 1; i < _scratchCount; ++i) {
+    Network network = scratch[i];
+    size_t j = i;
+    for (; j > 0 && scratch[j - 1].rssi < network.rssi; --j) {
+      scratch[j] = scratch[j - 1];
+    }
+    scratch[j] = network;
+  }
+
+  update();
+}
+
+/**
+ * @brief Replaces the table with the scratch table, recording what changed.
+ *
+ * A network that kept its signal level and security keeps the version it
+ * last changed in, so RSSI jitter within a level is not a change. Networks
+ * that are new or changed get the next version, as do the SSIDs missing from
+ * the new scan, which are remembered as removed. The version only advances
+ * if anything changed.
+ */
+void ScanEngine::update() {
+  const Network *scratch = _tables->scratch;
+  Network *networks = _tables->networks;
+  const uint32_t next = _version + 1;
+  uint32_t changedIn[WIFI_PROVISIONER_MAX_NETWORKS];
+  bool changed = _scratchCount != _count;
+
+  for (size_t i = 0; i < _scratchCount; ++i) {
+    const Network &network = scratch[i];
+    changedIn[i] = next;
+    size_t j = 0;
+    while (j < _count && strcmp(networks[j].ssid, network.ssid) != 0) {
+      ++j;
+    }
+    if (j == _count) {
+      forget(network.ssid);
+      changed = true;
+    } else if (signalLevel(networks[j].rssi) != signalLevel(network.rssi) ||
+               networks[j].open != network.open) {
+      changed = true;
+    } else {
+      changedIn[i] = _tables->changedIn[j];
+    }
+  }
+
+  for (size_t j = 0; j < _count; ++j) {
+    size_t i = 0;
+    while (i < _scratchCount &&
+           strcmp(scratch[i].ssid, networks[j].ssid) != 0) {
+      ++i;
+    }
+    if (i == _scratchCount) {
+      remember(networks[j].ssid, next);
+      changed = true;
+    }
+  }
+
+  for (size_t i = 0; i < _scratchCount; ++i) {
+    networks[i] = scratch[i];
+    _tables->changedIn[i] = changedIn[i];
+  }
+  _count = _scratchCount;
+  if (changed) {
+    _version = next;
+  }
+}
+
+/**
+ * @brief Records an SSID as removed in a version. Once the list is full, the
+ * oldest removal is dropped and the changes before it are no longer known.
+ */
+void ScanEngine::remember(const char *ssid, uint32_t version) {
+  Removal *removed = _tables->removed;
+  if (_removedCount == WIFI_PROVISIONER_MAX_NETWORKS) {
+    _horizon = removed[0].version;
+    memmove(removed, removed + 1, (_removedCount - 1) * sizeof(Removal));
+    _removedCount--;
+  }
+  Removal &removal = removed[_removedCount++];
+  strncpy(removal.ssid, ssid, sizeof(removal.ssid) - 1);
+  removal.ssid[sizeof(removal.ssid) - 1] = '\0';
+  removal.version = version;
+}
+
+/**
+ * @brief Drops the removal of an SSID that is back. Its return is listed as a
+ * change instead.
+ */
+void ScanEngine::forget(const char *ssid) {
+  Removal *removed = _tables->removed;
+  for (size_t i = 0; i < _removedCount; ++i) {
+    if (strcmp(removed[i].ssid, ssid) == 0) {
+      memmove(removed + i, removed + i + 1,
+              (_removedCount - i - 1) * sizeof(Removal));
+      _removedCount--;
+      return;
+    }
+  }
+}
+
+bool ScanEngine::isScanning() const { return _scanning; }
+
+bool ScanEngine::isStale() const {
+  return !_hasResults || millis() - _resultsAt >= _ttl;
+}
+
+bool ScanEngine::hasResults() const { return _hasResults; }
+
+size_t ScanEngine::count() const { return _count; }
+
+const ScanEngine::Network &ScanEngine::at(size_t index) const {
+  return _tables->networks[index];
+}
+
+/**
+ * @brief Returns the version of the table, which advances whenever a scan
+ * changes it. Version `0` is the table before the first scan.
+ */
+uint32_t ScanEngine::version() const { return _version; }
+
+/**
+ * @brief Returns whether all changes since a version are known, i.e. whether
+ * `changedIn()` and `removed()` bring a table of that version up to date.
+ */
+bool ScanEngine::knowsChangesSince(uint32_t since) const {
+  return since >= _horizon && since <= _version;
+}
+
+/**
+ * @brief Returns the version the network at an index last changed in.
+ */
+uint32_t ScanEngine::changedIn(size_t index) const {
+  return _tables->changedIn[index];
+}
+
+size_t ScanEngine::removedCount() const { return _removedCount; }
+
+/**
+ * @brief Returns a removed SSID, oldest first.
+ *
+ * @param index The index of the removal, below `removedCount()`.
+ * @param version Receives the version the network disappeared in.
+ */
+const char *ScanEngine::removed(size_t index, uint32_t &version) const {
+  version = _tables->removed[index].version;
+  return _tables->removed[index].ssid;
+}
+
+/**
+ * @brief Converts a Received Signal Strength Indicator (RSSI) value to a signal
+ * strength level.
+ *
+ * This function maps RSSI values to a step level ranging from 0 to 4 based on
+ * predefined minimum and maximum RSSI thresholds. The returned level provides
+ * an approximation of the signal quality.
+ *
+ * @param rssi The RSSI value (in dBm) representing the signal strength
+ * of a Wi-Fi network.
+ *
+ * @return An integer in the range [0, 4], where 0 indicates very poor signal
+ * strength and 4 indicates excellent signal strength.
+ */
+int ScanEngine::signalLevel(int rssi) {
+  //  Convert RSSI to 0 - 4 Step level
+  int numlevels = 4;
+  int MIN_RSSI = -100;
+  int MAX_RSSI = -55;
+
+  if (rssi < MIN_RSSI) {
+    return 0;
+  } else if (rssi >= MAX_RSSI) {
+    return numlevels;
+  } else {
+    int inputRange = MAX_RSSI - MIN_RSSI;
+    int res = std::ceil((rssi - MIN_RSSI) * numlevels / inputRange);
+    if (res == 0) {
+      return 1;
+    } else {
+      return res;
+    }
+  }
+}
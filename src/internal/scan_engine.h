@@ -0,0 +1,109 @@
+#ifndef SCAN_ENGINE_H
+#define SCAN_ENGINE_H
+
+#include "../WiFiProvisionerPlatform.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef WIFI_PROVISIONER_MAX_NETWORKS
+#define WIFI_PROVISIONER_MAX_NETWORKS 32 // Networks kept from a single scan
+#endif
+
+/**
+ * @brief Runs Wi-Fi scans in the background and caches the results.
+ *
+ * Scans are started asynchronously and collected by `poll()`, so the
+ * provisioning loop keeps serving DNS and HTTP requests while the radio scans.
+ * The results are kept in a fixed-size table together with the time they were
+ * collected, and are considered stale once they are older than the TTL. At
+ * most one scan is in flight at any time, and after a failed scan the next
+ * one is held off for a few seconds.
+ *
+ * Collecting a scan reduces it in a scratch table of the same size: hidden
+ * networks are dropped, each SSID is kept once with its strongest access
+ * point, and of those only the strongest `limit` are kept, sorted by signal
+ * strength. However many access points a dense environment reports, the
+ * table, the `/update` payload and the page's network list stay bounded.
+ *
+ * The results are versioned. A scan that adds or removes a network, or
+ * changes the signal level or security of one, gets the next version, and
+ * each network records the version it last changed in. The SSIDs that
+ * disappeared are remembered with the version they disappeared in, up to
+ * `WIFI_PROVISIONER_MAX_NETWORKS` of them, so the changes since any recent
+ * version can be listed instead of the whole table.
+ *
+ * The tables take about 4.5 KB with the default limit. They are allocated by
+ * `allocate()` when provisioning starts and freed by `release()`, so they
+ * cost nothing while the portal is not running.
+ */
+class ScanEngine {
+public:
+  using Network = WiFiProvisionerPlatform::Radio::Network;
+
+  explicit ScanEngine(WiFiProvisionerPlatform::Radio &radio);
+  ~ScanEngine();
+
+  bool allocate();
+  void release();
+
+  void setTtl(unsigned long ttl);
+  void setLimit(size_t limit);
+  bool start();
+  bool refresh();
+  void poll();
+  void reset();
+
+  bool isScanning() const;
+  bool isStale() const;
+  bool hasResults() const;
+  size_t count() const;
+  const Network &at(size_t index) const;
+
+  uint32_t version() const;
+  bool knowsChangesSince(uint32_t since) const;
+  uint32_t changedIn(size_t index) const;
+  size_t removedCount() const;
+  const char *removed(size_t index, uint32_t &version) const;
+
+  static int signalLevel(int rssi);
+
+private:
+  ScanEngine(const ScanEngine &) = delete;
+  ScanEngine &operator=(const ScanEngine &) = delete;
+
+  struct Removal {
+    char ssid[33];
+    uint32_t version; // Version the network disappeared in
+  };
+
+  struct Tables {
+    Network networks[WIFI_PROVISIONER_MAX_NETWORKS];
+    uint32_t changedIn[WIFI_PROVISIONER_MAX_NETWORKS];
+    Network scratch[WIFI_PROVISIONER_MAX_NETWORKS]; // Scan being collected
+    Removal removed[WIFI_PROVISIONER_MAX_NETWORKS]; // Oldest first
+  };
+
+  void fail();
+  void collect(size_t results);
+  void update();
+  void remember(const char *ssid, uint32_t version);
+  void forget(const char *ssid);
+
+  WiFiProvisionerPlatform::Radio &_radio;
+  Tables *_tables; // nullptr while not provisioning
+  size_t _count;
+  size_t _scratchCount;
+  size_t _removedCount;
+  uint32_t _version;
+  uint32_t _horizon; // Oldest version whose changes are all known
+  size_t _limit;
+  unsigned long _ttl;
+  unsigned long _scanStartedAt;
+  unsigned long _resultsAt;
+  unsigned long _failedAt;
+  bool _scanning;
+  bool _hasResults;
+  bool _failed; // Whether the last scan failed
+};
+
+#endif // SCAN_ENGINE_H
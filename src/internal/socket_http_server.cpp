@@ -0,0 +1,864 @@
+#include "socket_http_server.h"
+
+#if !defined(ARDUINO_ARCH_ESP32) || WIFI_PROVISIONER_SOCKET_SERVER
+
+#include <Arduino.h>
+#include <algorithm>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/poll.h>
+#include <unistd.h>
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <lwip/sockets.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace {
+
+const size_t MAX_HEADER_SIZE = 8192;
+const size_t MAX_BODY_SIZE = 16384; // Default body size limit
+const unsigned long CLIENT_TIMEOUT_MS = 2000;
+const int LISTEN_BACKLOG = 8;
+
+bool setNonBlocking(int fd) {
+  int flags = fcntl(fd, F_GETFL, 0);
+  return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) >= 0;
+}
+
+bool wouldBlock() { return errno == EAGAIN || errno == EWOULDBLOCK; }
+
+/**
+ * @brief Opens a non-blocking TCP socket listening on the given port on all
+ * interfaces.
+ *
+ * @return The socket, or `-1` on failure.
+ */
+int listenSocket(uint16_t port) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) {
+    return -1;
+  }
+
+  int reuse = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons(port);
+  if (bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 ||
+      listen(fd, LISTEN_BACKLOG) < 0 || !setNonBlocking(fd)) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+/**
+ * @brief Checks whether a header value contains `token`, ignoring case.
+ */
+bool containsToken(const char *value, const char *token) {
+  size_t length = strlen(token);
+  for (; *value; ++value) {
+    if (strncasecmp(value, token, length) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int hexValue(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+/**
+ * @brief Decodes a percent-encoded query string component.
+ */
+std::string urlDecode(const std::string &value) {
+  std::string decoded;
+  decoded.reserve(value.size());
+  for (size_t i = 0; i < value.size(); ++i) {
+    if (value[i] == '+') {
+      decoded += ' ';
+    } else if (value[i] == '%' && i + 2 < value.size() &&
+               hexValue(value[i + 1]) >= 0 && hexValue(value[i + 2]) >= 0) {
+      decoded += static_cast<char>(hexValue(value[i + 1]) * 16 +
+                                   hexValue(value[i + 2]));
+      i += 2;
+    } else {
+      decoded += value[i];
+    }
+  }
+  return decoded;
+}
+
+} // namespace
+
+const uint8_t *SocketHttpServer::Piece::data() const {
+  return borrowed ? borrowed : reinterpret_cast<const uint8_t *>(copy.data());
+}
+
+SocketHttpServer::SocketHttpServer(uint16_t port)
+    : _port(port), _listener(-1), _client(nullptr), _next(0), _idleTimeout(0),
+      _maxConnections(1), _maxBodySize(MAX_BODY_SIZE),
+      _keepAliveRequested(false), _http11(false), _responseEnded(false),
+      _resumed(false), _lastStream(NO_STREAM), _method(ANY), _stats() {}
+
+SocketHttpServer::~SocketHttpServer() { stop(); }
+
+void SocketHttpServer::on(const char *uri, Method method, Handler handler) {
+  _routes.push_back({uri, method, std::move(handler)});
+}
+
+void SocketHttpServer::onNotFound(Handler handler) {
+  _notFound = std::move(handler);
+}
+
+// Every request header is kept, so there is nothing to select
+void SocketHttpServer::collectHeaders(const char *names[], size_t count) {}
+
+bool SocketHttpServer::begin() {
+  _listener = listenSocket(_port);
+  return _listener >= 0;
+}
+
+void SocketHttpServer::stop() {
+  for (Connection &connection : _connections) {
+    closeConnection(connection);
+  }
+  _connections.clear();
+  _client = nullptr;
+  _resumed = false;
+  if (_listener >= 0) {
+    close(_listener);
+    _listener = -1;
+  }
+}
+
+/**
+ * @brief Polls all connections once without waiting.
+ *
+ * Pending response bytes are sent to every connection whose socket has room,
+ * new connections are accepted, and every connection with a complete request
+ * and no response still in flight gets that request served. The connections
+ * are visited starting from a different one on each call so that none of them
+ * is always served last.
+ */
+void SocketHttpServer::handleClient() {
+  if (_listener < 0) {
+    return;
+  }
+
+  size_t count = _connections.size();
+  _pollFds.resize(count + 1);
+  for (size_t i = 0; i < count; ++i) {
+    const Connection &connection = _connections[i];
+    _pollFds[i].fd = connection.fd;
+    _pollFds[i].events = POLLIN;
+    if (connection.queued > 0) {
+      _pollFds[i].events |= POLLOUT;
+    }
+    _pollFds[i].revents = 0;
+  }
+  _pollFds[count].fd = _listener;
+  _pollFds[count].events = POLLIN;
+  _pollFds[count].revents = 0;
+  if (poll(_pollFds.data(), count + 1, 0) < 0) {
+    return;
+  }
+
+  if (_pollFds[count].revents & POLLIN) {
+    acceptConnections();
+  }
+
+  // Connections accepted just now are read at once
+  size_t total = _connections.size();
+  for (size_t n = 0; n < total; ++n) {
+    size_t index = (_next + n) % total;
+    Connection &connection = _connections[index];
+    if (connection.fd < 0) {
+      continue;
+    }
+    short events = index < count ? _pollFds[index].revents : POLLIN;
+
+    // Finish earlier responses before reading further requests
+    bool sending = connection.queued > 0;
+    if (sending && (events & (POLLOUT | POLLERR | POLLHUP))) {
+      if (!flush(connection)) {
+        closeConnection(connection);
+        continue;
+      }
+      sending = connection.queued > 0;
+    }
+
+    bool open = true;
+    if (events & (POLLIN | POLLERR | POLLHUP)) {
+      open = receive(connection);
+    }
+
+    // A stream reads no requests and lasts until the client goes away
+    if (connection.stream != NO_STREAM) {
+      connection.input.clear();
+      if (!open || (connection.closing && !sending)) {
+        closeConnection(connection);
+      }
+      continue;
+    }
+
+    int parsed = 0;
+    if (!sending && !connection.closing) {
+      parsed = parseRequest(connection.input);
+      if (parsed > 0) {
+        serve(connection);
+        continue;
+      }
+      if (parsed == -2) {
+        rejectRequest(connection);
+        continue;
+      }
+    }
+
+    unsigned long timeout =
+        connection.idle && connection.input.empty() && !sending
+            ? _idleTimeout
+            : CLIENT_TIMEOUT_MS;
+    if ((connection.closing && !sending) || parsed < 0 ||
+        (!open && !sending) ||
+        millis() - connection.lastActivity >= timeout) {
+      closeConnection(connection);
+    }
+  }
+  _next = total ? (_next + 1) % total : 0;
+
+  _connections.erase(std::remove_if(_connections.begin(), _connections.end(),
+                                    [](const Connection &connection) {
+                                      return connection.fd < 0;
+                                    }),
+                     _connections.end());
+}
+
+/**
+ * @brief Accepts pending connections.
+ *
+ * When the connection limit is reached, the connection that has been idle the
+ * longest is closed to make room. If no connection is idle, new ones wait in
+ * the listen backlog until a slot frees up. Streams are not counted.
+ */
+void SocketHttpServer::acceptConnections() {
+  size_t limit = _idleTimeout ? _maxConnections : 1;
+  for (;;) {
+    size_t open = 0;
+    Connection *oldestIdle = nullptr;
+    for (Connection &connection : _connections) {
+      if (connection.fd < 0 || connection.stream != NO_STREAM) {
+        continue;
+      }
+      open++;
+      if (connection.idle && connection.input.empty() &&
+          connection.queued == 0 &&
+          (!oldestIdle ||
+           connection.lastActivity < oldestIdle->lastActivity)) {
+        oldestIdle = &connection;
+      }
+    }
+    if (open >= limit && !oldestIdle) {
+      return;
+    }
+
+    int fd = accept(_listener, nullptr, nullptr);
+    if (fd < 0) {
+      return;
+    }
+    if (!setNonBlocking(fd)) {
+      close(fd);
+      continue;
+    }
+    if (open >= limit) {
+      closeConnection(*oldestIdle);
+      open--;
+    }
+
+    // Responses are written in several pieces, and on a persistent connection
+    // Nagle's algorithm would hold the last one back until the client's
+    // delayed acknowledgement
+    int noDelay = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+    Connection connection = {};
+    connection.fd = fd;
+    connection.lastActivity = millis();
+    _connections.push_back(std::move(connection));
+
+    _stats.accepted++;
+    if (open + 1 > _stats.peakConnections) {
+      _stats.peakConnections = open + 1;
+    }
+  }
+}
+
+/**
+ * @brief Reads whatever the client has sent without blocking.
+ *
+ * @return `false` once the client has closed the connection or it failed.
+ */
+bool SocketHttpServer::receive(Connection &connection) {
+  char buffer[1024];
+  while (connection.input.size() <= MAX_HEADER_SIZE + _maxBodySize) {
+    ssize_t received =
+        recv(connection.fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+    if (received > 0) {
+      connection.input.append(buffer, received);
+      connection.lastActivity = millis();
+      continue;
+    }
+    if (received < 0 && wouldBlock()) {
+      return true;
+    }
+    if (received < 0 && errno == EINTR) {
+      continue;
+    }
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Sends as much of the queued response bytes as the socket takes.
+ *
+ * Each piece is freed once it has been sent, so that an idle connection does
+ * not hold on to a copy of a response.
+ *
+ * @return `false` if the connection failed.
+ */
+bool SocketHttpServer::flush(Connection &connection) {
+  while (!connection.output.empty()) {
+    Piece &piece = connection.output.front();
+    ssize_t result = send(connection.fd, piece.data() + connection.outputSent,
+                          piece.length - connection.outputSent,
+                          MSG_DONTWAIT | MSG_NOSIGNAL);
+    _stats.writeCalls++;
+    if (result > 0) {
+      connection.outputSent += result;
+      connection.queued -= result;
+      if (!piece.borrowed) {
+        connection.copied -= result;
+      }
+      connection.lastActivity = millis();
+      _stats.bytesWritten += result;
+      if (connection.outputSent == piece.length) {
+        connection.output.erase(connection.output.begin());
+        connection.outputSent = 0;
+      }
+      continue;
+    }
+    if (result < 0 && errno == EINTR) {
+      continue;
+    }
+    return result < 0 && wouldBlock();
+  }
+
+  std::vector<Piece>().swap(connection.output);
+  return true;
+}
+
+/**
+ * @brief Parses the first request in `input` and removes it from the buffer.
+ *
+ * @return `1` if a request was parsed, `0` if it is not complete yet, `-1` if
+ * it is malformed or its header is too large, or `-2` if its body exceeds the
+ * body size limit.
+ */
+int SocketHttpServer::parseRequest(std::string &input) {
+  size_t headerEnd = input.find("\r\n\r\n");
+  if (headerEnd == std::string::npos) {
+    return input.size() > MAX_HEADER_SIZE ? -1 : 0;
+  }
+
+  // Request line
+  size_t lineEnd = input.find("\r\n");
+  std::string line = input.substr(0, lineEnd);
+  size_t methodEnd = line.find(' ');
+  size_t targetEnd = line.find(' ', methodEnd + 1);
+  if (methodEnd == std::string::npos || targetEnd == std::string::npos) {
+    return -1;
+  }
+
+  // Headers
+  Fields headers;
+  size_t contentLength = 0;
+  size_t position = lineEnd + 2;
+  while (position < headerEnd) {
+    size_t end = input.find("\r\n", position);
+    std::string field = input.substr(position, end - position);
+    position = end + 2;
+
+    size_t colon = field.find(':');
+    if (colon == std::string::npos) {
+      continue;
+    }
+    size_t valueStart = field.find_first_not_of(' ', colon + 1);
+    std::string name = field.substr(0, colon);
+    std::string value =
+        valueStart == std::string::npos ? "" : field.substr(valueStart);
+    if (strcasecmp(name.c_str(), "Content-Length") == 0) {
+      contentLength = strtoul(value.c_str(), nullptr, 10);
+    }
+    headers.emplace_back(name, value);
+  }
+
+  // Body
+  if (contentLength > _maxBodySize) {
+    return -2;
+  }
+  size_t bodyStart = headerEnd + 4;
+  if (input.size() < bodyStart + contentLength) {
+    return 0;
+  }
+
+  _headers.swap(headers);
+  _body = input.substr(bodyStart, contentLength);
+  _args.clear();
+
+  std::string method = line.substr(0, methodEnd);
+  _method = method == "GET" ? GET : method == "POST" ? POST : ANY;
+
+  std::string target = line.substr(methodEnd + 1, targetEnd - methodEnd - 1);
+  size_t queryStart = target.find('?');
+  _path = target.substr(0, queryStart);
+  if (queryStart != std::string::npos) {
+    std::string query = target.substr(queryStart + 1);
+    size_t start = 0;
+    while (start <= query.size()) {
+      size_t end = query.find('&', start);
+      if (end == std::string::npos) {
+        end = query.size();
+      }
+      std::string field = query.substr(start, end - start);
+      if (!field.empty()) {
+        size_t equals = field.find('=');
+        _args.emplace_back(urlDecode(field.substr(0, equals)),
+                           equals == std::string::npos
+                               ? std::string()
+                               : urlDecode(field.substr(equals + 1)));
+      }
+      start = end + 1;
+    }
+  }
+
+  // HTTP/1.1 connections persist unless closed, HTTP/1.0 ones only on request
+  const char *connection = header("Connection");
+  _http11 = line.compare(targetEnd + 1, std::string::npos, "HTTP/1.1") == 0;
+  if (_http11) {
+    _keepAliveRequested = !containsToken(connection, "close");
+  } else {
+    _keepAliveRequested = containsToken(connection, "keep-alive");
+  }
+
+  input.erase(0, bodyStart + contentLength);
+  return 1;
+}
+
+/**
+ * @brief Runs the handler of the request just parsed from `connection`.
+ *
+ * A response the handler did not end closes the connection once it has been
+ * sent.
+ */
+void SocketHttpServer::serve(Connection &connection) {
+  _client = &connection;
+  _responseEnded = false;
+  connection.idle = false;
+  connection.lastActivity = millis();
+  _stats.requests++;
+
+  dispatch();
+
+  if (!_responseEnded) {
+    connection.closing = true;
+  }
+  _client = nullptr;
+  if (connection.closing && connection.queued == 0) {
+    closeConnection(connection);
+  }
+}
+
+void SocketHttpServer::dispatch() {
+  for (const Route &route : _routes) {
+    if (route.uri == _path &&
+        (route.method == ANY || route.method == _method)) {
+      route.handler();
+      return;
+    }
+  }
+
+  if (_notFound) {
+    _notFound();
+    return;
+  }
+
+  static const char response[] = " 404 Not Found\r\n"
+                                 "Content-Length: 0\r\n"
+                                 "Connection: close\r\n"
+                                 "\r\n";
+  const char *version = _http11 ? "HTTP/1.1" : "HTTP/1.0";
+  write(reinterpret_cast<const uint8_t *>(version), strlen(version));
+  write(reinterpret_cast<const uint8_t *>(response), sizeof(response) - 1);
+}
+
+/**
+ * @brief Answers a request whose body is too large with `413 Payload Too
+ * Large` and closes the connection once the response has been sent. The body
+ * is not read.
+ */
+void SocketHttpServer::rejectRequest(Connection &connection) {
+  static const char response[] = "HTTP/1.1 413 Payload Too Large\r\n"
+                                 "Content-Length: 0\r\n"
+                                 "Connection: close\r\n"
+                                 "\r\n";
+  Connection *client = _client;
+  _client = &connection;
+  write(reinterpret_cast<const uint8_t *>(response), sizeof(response) - 1);
+  _client = client;
+
+  connection.input.clear();
+  connection.closing = true;
+  _stats.requests++;
+}
+
+/**
+ * @brief Checks for a query argument, or for a request body when `name` is
+ * `"plain"`, like the ESP32 core's `WebServer`.
+ */
+bool SocketHttpServer::hasArg(const char *name) {
+  if (strcmp(name, "plain") == 0) {
+    return !_body.empty();
+  }
+  for (const auto &arg : _args) {
+    if (arg.first == name) {
+      return true;
+    }
+  }
+  return false;
+}
+
+const char *SocketHttpServer::arg(const char *name) {
+  if (strcmp(name, "plain") == 0) {
+    return _body.c_str();
+  }
+  for (const auto &arg : _args) {
+    if (arg.first == name) {
+      return arg.second.c_str();
+    }
+  }
+  return "";
+}
+
+const char *SocketHttpServer::header(const char *name) {
+  for (const auto &header : _headers) {
+    if (strcasecmp(header.first.c_str(), name) == 0) {
+      return header.second.c_str();
+    }
+  }
+  return "";
+}
+
+/**
+ * @brief Returns the path of the current request without its query.
+ */
+const char *SocketHttpServer::uri() { return _path.c_str(); }
+
+/**
+ * @brief Returns whether a request is being served, partly received, or its
+ * response is still being sent. A stream counts only while it has bytes to
+ * send.
+ */
+bool SocketHttpServer::clientConnected() {
+  if (_client != nullptr) {
+    return true;
+  }
+  for (const Connection &connection : _connections) {
+    if (connection.fd < 0) {
+      continue;
+    }
+    if (connection.queued > 0 ||
+        (connection.stream == NO_STREAM &&
+         (!connection.idle || !connection.input.empty()))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Sends response bytes to the current client without blocking.
+ *
+ * The bytes go to the socket directly while nothing is queued for the
+ * connection. Whatever the socket does not take is copied to the connection's
+ * queue and sent by later `handleClient()` calls. A connection whose queue
+ * would hold more copied bytes than its limit is closed instead, which is the
+ * queue size for a stream and `WIFI_PROVISIONER_RESPONSE_QUEUE_SIZE`
+ * otherwise.
+ *
+ * @return The number of bytes accepted, which is `length` unless the
+ * connection has failed or its response has ended.
+ */
+size_t SocketHttpServer::write(const uint8_t *data, size_t length) {
+  return queue(data, length, false);
+}
+
+/**
+ * @brief Sends response bytes like `write()`, but queues what the socket does
+ * not take as a pointer into `data`. Streams copy their bytes regardless, as
+ * they are written to outside of the request.
+ */
+size_t SocketHttpServer::writeBorrowed(const uint8_t *data, size_t length) {
+  return queue(data, length, true);
+}
+
+/**
+ * @brief Replaces every borrowed piece still queued with a copy of its
+ * unsent bytes. The copies do not count against the queue limit.
+ */
+void SocketHttpServer::detachBorrowed() {
+  for (Connection &connection : _connections) {
+    for (size_t i = 0; i < connection.output.size(); ++i) {
+      Piece &piece = connection.output[i];
+      if (!piece.borrowed) {
+        continue;
+      }
+      size_t sent = i == 0 ? connection.outputSent : 0;
+      piece.copy.assign(reinterpret_cast<const char *>(piece.borrowed) + sent,
+                        piece.length - sent);
+      piece.borrowed = nullptr;
+      piece.length -= sent;
+      connection.copied += piece.length;
+      if (i == 0) {
+        connection.outputSent = 0;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Sends bytes to the current client and queues what the socket does
+ * not take, as a copy or, if `borrowed` is set, as a pointer into `data`.
+ */
+size_t SocketHttpServer::queue(const uint8_t *data, size_t length,
+                               bool borrowed) {
+  Connection *connection = _client;
+  if (connection == nullptr || connection->fd < 0 || connection->closing) {
+    return 0;
+  }
+
+  size_t sent = 0;
+  if (connection->queued == 0) {
+    while (sent < length) {
+      ssize_t result = send(connection->fd, data + sent, length - sent,
+                            MSG_DONTWAIT | MSG_NOSIGNAL);
+      _stats.writeCalls++;
+      if (result > 0) {
+        sent += result;
+        continue;
+      }
+      if (result < 0 && errno == EINTR) {
+        continue;
+      }
+      if (result < 0 && wouldBlock()) {
+        break;
+      }
+      // The connection failed, drop the rest of the response
+      connection->closing = true;
+      _stats.bytesWritten += sent;
+      return sent;
+    }
+    _stats.bytesWritten += sent;
+  }
+  if (sent == length) {
+    return length;
+  }
+
+  size_t rest = length - sent;
+  bool stream = connection->stream != NO_STREAM;
+  borrowed = borrowed && !stream;
+  size_t limit =
+      stream ? connection->queueSize : WIFI_PROVISIONER_RESPONSE_QUEUE_SIZE;
+  if (!borrowed && connection->copied + rest > limit) {
+    _stats.overflows++;
+    closeConnection(*connection);
+    return sent;
+  }
+
+  std::vector<Piece> &output = connection->output;
+  if (borrowed) {
+    output.push_back({std::string(), data + sent, rest});
+  } else {
+    if (output.empty() || output.back().borrowed) {
+      output.push_back({std::string(), nullptr, 0});
+    } else if (output.size() == 1 && connection->outputSent > 0) {
+      // Only the unsent bytes are kept, so the limit bounds the memory
+      Piece &piece = output.front();
+      piece.copy.erase(0, connection->outputSent);
+      piece.length -= connection->outputSent;
+      connection->outputSent = 0;
+    }
+    Piece &piece = output.back();
+    piece.copy.append(reinterpret_cast<const char *>(data) + sent, rest);
+    piece.length += rest;
+    connection->copied += rest;
+  }
+  connection->queued += rest;
+  return length;
+}
+
+/**
+ * @brief Completes the current response. The connection is closed once the
+ * response has been sent, unless it persists or is a stream. For a resumed
+ * stream this only ends the caller's access to it.
+ */
+void SocketHttpServer::endResponse() {
+  if (_resumed) {
+    _resumed = false;
+    _client = nullptr;
+    return;
+  }
+  if (_client == nullptr || _responseEnded) {
+    return;
+  }
+  _responseEnded = true;
+  if (_client->stream != NO_STREAM) {
+    return;
+  }
+
+  if (keepAlive()) {
+    _client->idle = true;
+    _client->lastActivity = millis();
+  } else {
+    _client->closing = true;
+  }
+}
+
+/**
+ * @brief Enables persistent connections.
+ *
+ * @param idleTimeout How long an idle connection is kept open in
+ * milliseconds, `0` closes every connection after its response.
+ * @param maxConnections How many connections may be open at once.
+ */
+bool SocketHttpServer::setKeepAlive(unsigned long idleTimeout,
+                                    size_t maxConnections) {
+  _idleTimeout = idleTimeout;
+  _maxConnections = maxConnections ? maxConnections : 1;
+  return true;
+}
+
+/**
+ * @brief Sets the largest request body the server reads.
+ */
+bool SocketHttpServer::setMaxBodySize(size_t size) {
+  _maxBodySize = size;
+  return true;
+}
+
+bool SocketHttpServer::keepAlive() {
+  return _client != nullptr && _client->stream == NO_STREAM &&
+         _idleTimeout > 0 && _keepAliveRequested;
+}
+
+/**
+ * @brief Allows chunked responses to HTTP/1.1 requests. HTTP/1.0 responses
+ * without a length are ended by closing the connection, as are streams.
+ */
+bool SocketHttpServer::beginChunked() {
+  if (!_http11 || (_client != nullptr && _client->stream != NO_STREAM)) {
+    _keepAliveRequested = false;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Turns the connection of the current request into a stream. Requests
+ * pipelined behind it are dropped.
+ */
+uint32_t SocketHttpServer::beginStream(size_t queueSize) {
+  if (_client == nullptr || _resumed || _client->stream != NO_STREAM) {
+    return NO_STREAM;
+  }
+  if (++_lastStream == NO_STREAM) {
+    ++_lastStream;
+  }
+  _client->stream = _lastStream;
+  _client->queueSize = queueSize;
+  _client->input.clear();
+  return _client->stream;
+}
+
+bool SocketHttpServer::resumeStream(uint32_t stream) {
+  if (_client != nullptr || stream == NO_STREAM) {
+    return false;
+  }
+  for (Connection &connection : _connections) {
+    if (connection.stream == stream && connection.fd >= 0 &&
+        !connection.closing) {
+      _client = &connection;
+      _resumed = true;
+      return true;
+    }
+  }
+  return false;
+}
+
+void SocketHttpServer::closeStream(uint32_t stream) {
+  for (Connection &connection : _connections) {
+    if (stream != NO_STREAM && connection.stream == stream) {
+      closeConnection(connection);
+    }
+  }
+}
+
+SocketHttpServer::Stats SocketHttpServer::stats() {
+  Stats stats = _stats;
+  stats.connections = 0;
+  for (const Connection &connection : _connections) {
+    if (connection.fd >= 0) {
+      stats.connections++;
+    }
+  }
+  return stats;
+}
+
+void SocketHttpServer::closeConnection(Connection &connection) {
+  if (connection.fd < 0) {
+    return;
+  }
+  shutdown(connection.fd, SHUT_WR);
+  close(connection.fd);
+  connection.fd = -1;
+  std::string().swap(connection.input);
+  std::vector<Piece>().swap(connection.output);
+  connection.outputSent = 0;
+  connection.queued = 0;
+  connection.copied = 0;
+}
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef SOCKET_HTTP_SERVER_H
+#define SOCKET_HTTP_SERVER_H
+
+#include "../WiFiProvisionerPlatform.h"
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef WIFI_PROVISIONER_SOCKET_SERVER
+#define WIFI_PROVISIONER_SOCKET_SERVER 1 // 0 uses the core's WebServer
+#endif
+
+#ifndef WIFI_PROVISIONER_RESPONSE_QUEUE_SIZE
+#define WIFI_PROVISIONER_RESPONSE_QUEUE_SIZE 8192 // Copied bytes per response
+#endif
+
+struct pollfd;
+
+/**
+ * @brief HTTP/1.x server that multiplexes its connections on non-blocking
+ * sockets.
+ *
+ * Each `handleClient()` call polls all connections once without waiting,
+ * sends pending response bytes to every connection that can take them, and
+ * serves at most one complete request per connection. `write()` never blocks:
+ * whatever the socket does not accept at once is queued on the connection and
+ * sent by later calls, so a client downloading the page does not hold up the
+ * requests of other clients.
+ *
+ * A connection reads no further request until its queue has been sent, so it
+ * queues at most one response. Bytes passed to `writeBorrowed()`, such as the
+ * cached page, are queued as a pointer into the caller's buffer, and other
+ * bytes are copied. A response that would queue more than
+ * `WIFI_PROVISIONER_RESPONSE_QUEUE_SIZE` copied bytes closes its connection
+ * and counts as an overflow.
+ *
+ * With keep-alive enabled a connection stays open between requests until it
+ * has been idle for the idle timeout, and pipelined requests are served in
+ * order once the previous response has been sent.
+ *
+ * A connection turned into a stream stays open until the client closes it or
+ * falls behind by more than its queue size. Streams neither time out nor
+ * count against the connection limit; the caller bounds how many it keeps.
+ *
+ * The server uses the BSD socket API, which lwIP provides on ESP32. It is the
+ * HTTP server of the Linux host build and, unless
+ * `WIFI_PROVISIONER_SOCKET_SERVER` is defined to `0`, of the ESP32 platform.
+ */
+class SocketHttpServer : public WiFiProvisionerPlatform::HttpServer {
+public:
+  explicit SocketHttpServer(uint16_t port);
+  ~SocketHttpServer() override;
+
+  void on(const char *uri, Method method, Handler handler) override;
+  void onNotFound(Handler handler) override;
+  void collectHeaders(const char *names[], size_t count) override;
+  bool begin() override;
+  void stop() override;
+  void handleClient() override;
+
+  bool hasArg(const char *name) override;
+  const char *arg(const char *name) override;
+  const char *header(const char *name) override;
+  const char *uri() override;
+  bool clientConnected() override;
+
+  size_t write(const uint8_t *data, size_t length) override;
+  size_t writeBorrowed(const uint8_t *data, size_t length) override;
+  void detachBorrowed() override;
+  void endResponse() override;
+
+  bool setKeepAlive(unsigned long idleTimeout, size_t maxConnections) override;
+  bool keepAlive() override;
+  bool beginChunked() override;
+  bool setMaxBodySize(size_t size) override;
+  uint32_t beginStream(size_t queueSize) override;
+  bool resumeStream(uint32_t stream) override;
+  void closeStream(uint32_t stream) override;
+  Stats stats() override;
+
+private:
+  SocketHttpServer(const SocketHttpServer &) = delete;
+  SocketHttpServer &operator=(const SocketHttpServer &) = delete;
+
+  struct Route {
+    std::string uri;
+    Method method;
+    Handler handler;
+  };
+
+  // Queued response bytes, either copied or borrowed from the caller
+  struct Piece {
+    std::string copy;
+    const uint8_t *borrowed; // `nullptr` for copied bytes
+    size_t length;
+
+    const uint8_t *data() const;
+  };
+
+  struct Connection {
+    int fd;
+    std::string input;         // Received bytes not yet parsed
+    std::vector<Piece> output; // Response bytes the socket has not taken yet
+    size_t outputSent;         // Bytes of the first piece already sent
+    size_t queued;             // Unsent bytes in `output`
+    size_t copied;             // Copied bytes in `output`
+    unsigned long lastActivity;
+    bool idle;    // Between requests of a persistent connection
+    bool closing; // Close once `output` has been sent
+    uint32_t stream;  // Id of the event stream, or `NO_STREAM`
+    size_t queueSize; // Most unsent bytes the stream may queue
+  };
+
+  using Fields = std::vector<std::pair<std::string, std::string>>;
+
+  void acceptConnections();
+  bool receive(Connection &connection);
+  bool flush(Connection &connection);
+  size_t queue(const uint8_t *data, size_t length, bool borrowed);
+  int parseRequest(std::string &input);
+  void serve(Connection &connection);
+  void rejectRequest(Connection &connection);
+  void dispatch();
+  void closeConnection(Connection &connection);
+
+  uint16_t _port;
+  int _listener;
+  Connection *_client; // Connection of the request being served
+  std::vector<Connection> _connections;
+  std::vector<pollfd> _pollFds;
+  size_t _next;
+  unsigned long _idleTimeout;
+  size_t _maxConnections;
+  size_t _maxBodySize;
+  bool _keepAliveRequested;
+  bool _http11; // Whether the current request is HTTP/1.1
+  bool _responseEnded;
+  bool _resumed;        // Whether `_client` is a stream resumed by a caller
+  uint32_t _lastStream; // Id of the stream begun last
+  std::vector<Route> _routes;
+  Handler _notFound;
+  Method _method;
+  std::string _path;
+  std::string _body;
+  Fields _args;
+  Fields _headers;
+  Stats _stats;
+};
+
+#endif // SOCKET_HTTP_SERVER_H